@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "simdzone::zone" for configuration "Debug"
+set_property(TARGET simdzone::zone APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(simdzone::zone PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libzone.a"
+  )
+
+list(APPEND _cmake_import_check_targets simdzone::zone )
+list(APPEND _cmake_import_check_files_for_simdzone::zone "${_IMPORT_PREFIX}/lib/libzone.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
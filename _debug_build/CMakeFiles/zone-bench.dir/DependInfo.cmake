@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/bench.c" "CMakeFiles/zone-bench.dir/src/bench.c.o" "gcc" "CMakeFiles/zone-bench.dir/src/bench.c.o.d"
+  "/root/repo/src/fallback/bench.c" "CMakeFiles/zone-bench.dir/src/fallback/bench.c.o" "gcc" "CMakeFiles/zone-bench.dir/src/fallback/bench.c.o.d"
+  "/root/repo/src/haswell/bench.c" "CMakeFiles/zone-bench.dir/src/haswell/bench.c.o" "gcc" "CMakeFiles/zone-bench.dir/src/haswell/bench.c.o.d"
+  "/root/repo/src/westmere/bench.c" "CMakeFiles/zone-bench.dir/src/westmere/bench.c.o" "gcc" "CMakeFiles/zone-bench.dir/src/westmere/bench.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/CMakeFiles/zone.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zone-bench.dir/src/bench.c.o"
+  "CMakeFiles/zone-bench.dir/src/bench.c.o.d"
+  "CMakeFiles/zone-bench.dir/src/fallback/bench.c.o"
+  "CMakeFiles/zone-bench.dir/src/fallback/bench.c.o.d"
+  "CMakeFiles/zone-bench.dir/src/haswell/bench.c.o"
+  "CMakeFiles/zone-bench.dir/src/haswell/bench.c.o.d"
+  "CMakeFiles/zone-bench.dir/src/westmere/bench.c.o"
+  "CMakeFiles/zone-bench.dir/src/westmere/bench.c.o.d"
+  "zone-bench"
+  "zone-bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zone-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/fallback/parser.c" "CMakeFiles/zone.dir/src/fallback/parser.c.o" "gcc" "CMakeFiles/zone.dir/src/fallback/parser.c.o.d"
+  "/root/repo/src/haswell/parser.c" "CMakeFiles/zone.dir/src/haswell/parser.c.o" "gcc" "CMakeFiles/zone.dir/src/haswell/parser.c.o.d"
+  "/root/repo/src/sort.c" "CMakeFiles/zone.dir/src/sort.c.o" "gcc" "CMakeFiles/zone.dir/src/sort.c.o.d"
+  "/root/repo/src/westmere/parser.c" "CMakeFiles/zone.dir/src/westmere/parser.c.o" "gcc" "CMakeFiles/zone.dir/src/westmere/parser.c.o.d"
+  "/root/repo/src/zone.c" "CMakeFiles/zone.dir/src/zone.c.o" "gcc" "CMakeFiles/zone.dir/src/zone.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zone.dir/src/fallback/parser.c.o"
+  "CMakeFiles/zone.dir/src/fallback/parser.c.o.d"
+  "CMakeFiles/zone.dir/src/haswell/parser.c.o"
+  "CMakeFiles/zone.dir/src/haswell/parser.c.o.d"
+  "CMakeFiles/zone.dir/src/sort.c.o"
+  "CMakeFiles/zone.dir/src/sort.c.o.d"
+  "CMakeFiles/zone.dir/src/westmere/parser.c.o"
+  "CMakeFiles/zone.dir/src/westmere/parser.c.o.d"
+  "CMakeFiles/zone.dir/src/zone.c.o"
+  "CMakeFiles/zone.dir/src/zone.c.o.d"
+  "libzone.a"
+  "libzone.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zone.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
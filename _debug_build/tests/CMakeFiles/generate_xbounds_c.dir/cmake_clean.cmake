@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_xbounds_c"
+  "xbounds.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/generate_xbounds_c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
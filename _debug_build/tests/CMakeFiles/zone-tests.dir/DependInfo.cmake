@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/allocator.c" "tests/CMakeFiles/zone-tests.dir/allocator.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/allocator.c.o.d"
+  "/root/repo/tests/arena.c" "tests/CMakeFiles/zone-tests.dir/arena.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/arena.c.o.d"
+  "/root/repo/tests/base16.c" "tests/CMakeFiles/zone-tests.dir/base16.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/base16.c.o.d"
+  "/root/repo/tests/base32.c" "tests/CMakeFiles/zone-tests.dir/base32.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/base32.c.o.d"
+  "/root/repo/tests/batch.c" "tests/CMakeFiles/zone-tests.dir/batch.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/batch.c.o.d"
+  "/root/repo/tests/bits.c" "tests/CMakeFiles/zone-tests.dir/bits.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/bits.c.o.d"
+  "/root/repo/tests/bounds.c" "tests/CMakeFiles/zone-tests.dir/bounds.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/bounds.c.o.d"
+  "/root/repo/tests/canonical.c" "tests/CMakeFiles/zone-tests.dir/canonical.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/canonical.c.o.d"
+  "/root/repo/tests/checkpoint.c" "tests/CMakeFiles/zone-tests.dir/checkpoint.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/checkpoint.c.o.d"
+  "/root/repo/tests/diagnostics.c" "tests/CMakeFiles/zone-tests.dir/diagnostics.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/diagnostics.c.o.d"
+  "/root/repo/tests/estimate.c" "tests/CMakeFiles/zone-tests.dir/estimate.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/estimate.c.o.d"
+  "/root/repo/tests/eui.c" "tests/CMakeFiles/zone-tests.dir/eui.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/eui.c.o.d"
+  "/root/repo/tests/fallback/bits.c" "tests/CMakeFiles/zone-tests.dir/fallback/bits.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/fallback/bits.c.o.d"
+  "/root/repo/tests/filter.c" "tests/CMakeFiles/zone-tests.dir/filter.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/filter.c.o.d"
+  "/root/repo/tests/hash.c" "tests/CMakeFiles/zone-tests.dir/hash.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/hash.c.o.d"
+  "/root/repo/tests/haswell/bits.c" "tests/CMakeFiles/zone-tests.dir/haswell/bits.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/haswell/bits.c.o.d"
+  "/root/repo/tests/include.c" "tests/CMakeFiles/zone-tests.dir/include.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/include.c.o.d"
+  "/root/repo/tests/ip4.c" "tests/CMakeFiles/zone-tests.dir/ip4.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/ip4.c.o.d"
+  "/root/repo/tests/labels.c" "tests/CMakeFiles/zone-tests.dir/labels.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/labels.c.o.d"
+  "/root/repo/tests/lazy.c" "tests/CMakeFiles/zone-tests.dir/lazy.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/lazy.c.o.d"
+  "/root/repo/tests/next.c" "tests/CMakeFiles/zone-tests.dir/next.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/next.c.o.d"
+  "/root/repo/tests/partition.c" "tests/CMakeFiles/zone-tests.dir/partition.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/partition.c.o.d"
+  "/root/repo/tests/peek.c" "tests/CMakeFiles/zone-tests.dir/peek.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/peek.c.o.d"
+  "/root/repo/tests/reuse.c" "tests/CMakeFiles/zone-tests.dir/reuse.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/reuse.c.o.d"
+  "/root/repo/tests/rrset.c" "tests/CMakeFiles/zone-tests.dir/rrset.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/rrset.c.o.d"
+  "/root/repo/tests/semantics.c" "tests/CMakeFiles/zone-tests.dir/semantics.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/semantics.c.o.d"
+  "/root/repo/tests/skip.c" "tests/CMakeFiles/zone-tests.dir/skip.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/skip.c.o.d"
+  "/root/repo/tests/sort.c" "tests/CMakeFiles/zone-tests.dir/sort.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/sort.c.o.d"
+  "/root/repo/tests/step.c" "tests/CMakeFiles/zone-tests.dir/step.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/step.c.o.d"
+  "/root/repo/tests/subtree.c" "tests/CMakeFiles/zone-tests.dir/subtree.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/subtree.c.o.d"
+  "/root/repo/tests/svcb.c" "tests/CMakeFiles/zone-tests.dir/svcb.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/svcb.c.o.d"
+  "/root/repo/tests/syntax.c" "tests/CMakeFiles/zone-tests.dir/syntax.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/syntax.c.o.d"
+  "/root/repo/tests/tapes.c" "tests/CMakeFiles/zone-tests.dir/tapes.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/tapes.c.o.d"
+  "/root/repo/tests/template.c" "tests/CMakeFiles/zone-tests.dir/template.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/template.c.o.d"
+  "/root/repo/tests/time.c" "tests/CMakeFiles/zone-tests.dir/time.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/time.c.o.d"
+  "/root/repo/tests/tools.c" "tests/CMakeFiles/zone-tests.dir/tools.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/tools.c.o.d"
+  "/root/repo/tests/ttl.c" "tests/CMakeFiles/zone-tests.dir/ttl.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/ttl.c.o.d"
+  "/root/repo/tests/types.c" "tests/CMakeFiles/zone-tests.dir/types.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/types.c.o.d"
+  "/root/repo/tests/westmere/bits.c" "tests/CMakeFiles/zone-tests.dir/westmere/bits.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/westmere/bits.c.o.d"
+  "/root/repo/_debug_build/tests/xbounds.c" "tests/CMakeFiles/zone-tests.dir/xbounds.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/xbounds.c.o.d"
+  "/root/repo/_debug_build/tests/zone-tests.c" "tests/CMakeFiles/zone-tests.dir/zone-tests.c.o" "gcc" "tests/CMakeFiles/zone-tests.dir/zone-tests.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/CMakeFiles/zone.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,92 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zone-tests.dir/allocator.c.o"
+  "CMakeFiles/zone-tests.dir/allocator.c.o.d"
+  "CMakeFiles/zone-tests.dir/arena.c.o"
+  "CMakeFiles/zone-tests.dir/arena.c.o.d"
+  "CMakeFiles/zone-tests.dir/base16.c.o"
+  "CMakeFiles/zone-tests.dir/base16.c.o.d"
+  "CMakeFiles/zone-tests.dir/base32.c.o"
+  "CMakeFiles/zone-tests.dir/base32.c.o.d"
+  "CMakeFiles/zone-tests.dir/batch.c.o"
+  "CMakeFiles/zone-tests.dir/batch.c.o.d"
+  "CMakeFiles/zone-tests.dir/bits.c.o"
+  "CMakeFiles/zone-tests.dir/bits.c.o.d"
+  "CMakeFiles/zone-tests.dir/bounds.c.o"
+  "CMakeFiles/zone-tests.dir/bounds.c.o.d"
+  "CMakeFiles/zone-tests.dir/canonical.c.o"
+  "CMakeFiles/zone-tests.dir/canonical.c.o.d"
+  "CMakeFiles/zone-tests.dir/checkpoint.c.o"
+  "CMakeFiles/zone-tests.dir/checkpoint.c.o.d"
+  "CMakeFiles/zone-tests.dir/diagnostics.c.o"
+  "CMakeFiles/zone-tests.dir/diagnostics.c.o.d"
+  "CMakeFiles/zone-tests.dir/estimate.c.o"
+  "CMakeFiles/zone-tests.dir/estimate.c.o.d"
+  "CMakeFiles/zone-tests.dir/eui.c.o"
+  "CMakeFiles/zone-tests.dir/eui.c.o.d"
+  "CMakeFiles/zone-tests.dir/fallback/bits.c.o"
+  "CMakeFiles/zone-tests.dir/fallback/bits.c.o.d"
+  "CMakeFiles/zone-tests.dir/filter.c.o"
+  "CMakeFiles/zone-tests.dir/filter.c.o.d"
+  "CMakeFiles/zone-tests.dir/hash.c.o"
+  "CMakeFiles/zone-tests.dir/hash.c.o.d"
+  "CMakeFiles/zone-tests.dir/haswell/bits.c.o"
+  "CMakeFiles/zone-tests.dir/haswell/bits.c.o.d"
+  "CMakeFiles/zone-tests.dir/include.c.o"
+  "CMakeFiles/zone-tests.dir/include.c.o.d"
+  "CMakeFiles/zone-tests.dir/ip4.c.o"
+  "CMakeFiles/zone-tests.dir/ip4.c.o.d"
+  "CMakeFiles/zone-tests.dir/labels.c.o"
+  "CMakeFiles/zone-tests.dir/labels.c.o.d"
+  "CMakeFiles/zone-tests.dir/lazy.c.o"
+  "CMakeFiles/zone-tests.dir/lazy.c.o.d"
+  "CMakeFiles/zone-tests.dir/next.c.o"
+  "CMakeFiles/zone-tests.dir/next.c.o.d"
+  "CMakeFiles/zone-tests.dir/partition.c.o"
+  "CMakeFiles/zone-tests.dir/partition.c.o.d"
+  "CMakeFiles/zone-tests.dir/peek.c.o"
+  "CMakeFiles/zone-tests.dir/peek.c.o.d"
+  "CMakeFiles/zone-tests.dir/reuse.c.o"
+  "CMakeFiles/zone-tests.dir/reuse.c.o.d"
+  "CMakeFiles/zone-tests.dir/rrset.c.o"
+  "CMakeFiles/zone-tests.dir/rrset.c.o.d"
+  "CMakeFiles/zone-tests.dir/semantics.c.o"
+  "CMakeFiles/zone-tests.dir/semantics.c.o.d"
+  "CMakeFiles/zone-tests.dir/skip.c.o"
+  "CMakeFiles/zone-tests.dir/skip.c.o.d"
+  "CMakeFiles/zone-tests.dir/sort.c.o"
+  "CMakeFiles/zone-tests.dir/sort.c.o.d"
+  "CMakeFiles/zone-tests.dir/step.c.o"
+  "CMakeFiles/zone-tests.dir/step.c.o.d"
+  "CMakeFiles/zone-tests.dir/subtree.c.o"
+  "CMakeFiles/zone-tests.dir/subtree.c.o.d"
+  "CMakeFiles/zone-tests.dir/svcb.c.o"
+  "CMakeFiles/zone-tests.dir/svcb.c.o.d"
+  "CMakeFiles/zone-tests.dir/syntax.c.o"
+  "CMakeFiles/zone-tests.dir/syntax.c.o.d"
+  "CMakeFiles/zone-tests.dir/tapes.c.o"
+  "CMakeFiles/zone-tests.dir/tapes.c.o.d"
+  "CMakeFiles/zone-tests.dir/template.c.o"
+  "CMakeFiles/zone-tests.dir/template.c.o.d"
+  "CMakeFiles/zone-tests.dir/time.c.o"
+  "CMakeFiles/zone-tests.dir/time.c.o.d"
+  "CMakeFiles/zone-tests.dir/tools.c.o"
+  "CMakeFiles/zone-tests.dir/tools.c.o.d"
+  "CMakeFiles/zone-tests.dir/ttl.c.o"
+  "CMakeFiles/zone-tests.dir/ttl.c.o.d"
+  "CMakeFiles/zone-tests.dir/types.c.o"
+  "CMakeFiles/zone-tests.dir/types.c.o.d"
+  "CMakeFiles/zone-tests.dir/westmere/bits.c.o"
+  "CMakeFiles/zone-tests.dir/westmere/bits.c.o.d"
+  "CMakeFiles/zone-tests.dir/xbounds.c.o"
+  "CMakeFiles/zone-tests.dir/xbounds.c.o.d"
+  "CMakeFiles/zone-tests.dir/zone-tests.c.o"
+  "CMakeFiles/zone-tests.dir/zone-tests.c.o.d"
+  "xbounds.c"
+  "zone-tests"
+  "zone-tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zone-tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
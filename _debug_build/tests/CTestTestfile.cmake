@@ -0,0 +1,178 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_debug_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(supported_types "/root/repo/_debug_build/tests/zone-tests" "-g" "types" "-t" "supported_types")
+set_tests_properties(supported_types PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(include_from_string "/root/repo/_debug_build/tests/zone-tests" "-g" "include" "-t" "include_from_string")
+set_tests_properties(include_from_string PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(the_file_that_wasnt "/root/repo/_debug_build/tests/zone-tests" "-g" "include" "-t" "the_file_that_wasnt")
+set_tests_properties(the_file_that_wasnt PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(the_include_that_wasnt "/root/repo/_debug_build/tests/zone-tests" "-g" "include" "-t" "the_include_that_wasnt")
+set_tests_properties(the_include_that_wasnt PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(in_too_deep "/root/repo/_debug_build/tests/zone-tests" "-g" "include" "-t" "in_too_deep")
+set_tests_properties(in_too_deep PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(been_there_done_that "/root/repo/_debug_build/tests/zone-tests" "-g" "include" "-t" "been_there_done_that")
+set_tests_properties(been_there_done_that PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(include_relative "/root/repo/_debug_build/tests/zone-tests" "-g" "include" "-t" "include_relative")
+set_tests_properties(include_relative PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(track_includes "/root/repo/_debug_build/tests/zone-tests" "-g" "include" "-t" "track_includes")
+set_tests_properties(track_includes PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ipv4_syntax "/root/repo/_debug_build/tests/zone-tests" "-g" "ip4" "-t" "ipv4_syntax")
+set_tests_properties(ipv4_syntax PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(time_stamp_syntax "/root/repo/_debug_build/tests/zone-tests" "-g" "time" "-t" "time_stamp_syntax")
+set_tests_properties(time_stamp_syntax PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(base16_syntax "/root/repo/_debug_build/tests/zone-tests" "-g" "base16" "-t" "base16_syntax")
+set_tests_properties(base16_syntax PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(base32_syntax "/root/repo/_debug_build/tests/zone-tests" "-g" "base32" "-t" "base32_syntax")
+set_tests_properties(base32_syntax PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(rfc9460_test_vectors "/root/repo/_debug_build/tests/zone-tests" "-g" "svcb" "-t" "rfc9460_test_vectors")
+set_tests_properties(rfc9460_test_vectors PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(newlines "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "newlines")
+set_tests_properties(newlines PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(strings "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "strings")
+set_tests_properties(strings PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(names "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "names")
+set_tests_properties(names PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ttls "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "ttls")
+set_tests_properties(ttls PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(who_dis "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "who_dis")
+set_tests_properties(who_dis PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(quote_no_unquote "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "quote_no_unquote")
+set_tests_properties(quote_no_unquote PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(not_so_famous_last_words "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "not_so_famous_last_words")
+set_tests_properties(not_so_famous_last_words PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(no_famous_last_words "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "no_famous_last_words")
+set_tests_properties(no_famous_last_words PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(bad_a_rrs "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "bad_a_rrs")
+set_tests_properties(bad_a_rrs PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(bad_ttls "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "bad_ttls")
+set_tests_properties(bad_ttls PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(bad_origins "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "bad_origins")
+set_tests_properties(bad_origins PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(bad_includes "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "bad_includes")
+set_tests_properties(bad_includes PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(include_with_origin "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "include_with_origin")
+set_tests_properties(include_with_origin PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(include_without_origin "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "include_without_origin")
+set_tests_properties(include_without_origin PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(owner_is_reinstated "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "owner_is_reinstated")
+set_tests_properties(owner_is_reinstated PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(origin_is_reinstated "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "origin_is_reinstated")
+set_tests_properties(origin_is_reinstated PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(contiguous_escaped_start "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "contiguous_escaped_start")
+set_tests_properties(contiguous_escaped_start PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(quoted_escaped_start "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "quoted_escaped_start")
+set_tests_properties(quoted_escaped_start PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(contiguous_escaped_reset "/root/repo/_debug_build/tests/zone-tests" "-g" "syntax" "-t" "contiguous_escaped_reset")
+set_tests_properties(contiguous_escaped_reset PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ds_digest_lengths "/root/repo/_debug_build/tests/zone-tests" "-g" "semantics" "-t" "ds_digest_lengths")
+set_tests_properties(ds_digest_lengths PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(zonemd_digest_lengths "/root/repo/_debug_build/tests/zone-tests" "-g" "semantics" "-t" "zonemd_digest_lengths")
+set_tests_properties(zonemd_digest_lengths PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(dsync_scheme_types "/root/repo/_debug_build/tests/zone-tests" "-g" "semantics" "-t" "dsync_scheme_types")
+set_tests_properties(dsync_scheme_types PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(eui48_and_eui64 "/root/repo/_debug_build/tests/zone-tests" "-g" "eui" "-t" "eui48_and_eui64")
+set_tests_properties(eui48_and_eui64 PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(block_boundary "/root/repo/_debug_build/tests/zone-tests" "-g" "bounds" "-t" "block_boundary")
+set_tests_properties(block_boundary PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(contiguous_on_buffer_boundary "/root/repo/_debug_build/tests/zone-tests" "-g" "bounds" "-t" "contiguous_on_buffer_boundary")
+set_tests_properties(contiguous_on_buffer_boundary PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_trailing_zeroes "/root/repo/_debug_build/tests/zone-tests" "-g" "bits" "-t" "test_trailing_zeroes")
+set_tests_properties(test_trailing_zeroes PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_leading_zeroes "/root/repo/_debug_build/tests/zone-tests" "-g" "bits" "-t" "test_leading_zeroes")
+set_tests_properties(test_leading_zeroes PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_prefix_xor "/root/repo/_debug_build/tests/zone-tests" "-g" "bits" "-t" "test_prefix_xor")
+set_tests_properties(test_prefix_xor PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_add_overflow "/root/repo/_debug_build/tests/zone-tests" "-g" "bits" "-t" "test_add_overflow")
+set_tests_properties(test_add_overflow PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(correct_ttl_is_used "/root/repo/_debug_build/tests/zone-tests" "-g" "ttl" "-t" "correct_ttl_is_used")
+set_tests_properties(correct_ttl_is_used PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(correct_ttl_is_used_in_include "/root/repo/_debug_build/tests/zone-tests" "-g" "ttl" "-t" "correct_ttl_is_used_in_include")
+set_tests_properties(correct_ttl_is_used_in_include PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(owners_map_to_same_partition "/root/repo/_debug_build/tests/zone-tests" "-g" "partition" "-t" "owners_map_to_same_partition")
+set_tests_properties(owners_map_to_same_partition PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(partition_requires_callback "/root/repo/_debug_build/tests/zone-tests" "-g" "partition" "-t" "partition_requires_callback")
+set_tests_properties(partition_requires_callback PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(resume_from_every_checkpoint "/root/repo/_debug_build/tests/zone-tests" "-g" "checkpoint" "-t" "resume_from_every_checkpoint")
+set_tests_properties(resume_from_every_checkpoint PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(canonical_name_order "/root/repo/_debug_build/tests/zone-tests" "-g" "sort" "-t" "canonical_name_order")
+set_tests_properties(canonical_name_order PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(canonical_rr_order "/root/repo/_debug_build/tests/zone-tests" "-g" "sort" "-t" "canonical_rr_order")
+set_tests_properties(canonical_rr_order PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(sort_slices "/root/repo/_debug_build/tests/zone-tests" "-g" "sort" "-t" "sort_slices")
+set_tests_properties(sort_slices PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(external_sort "/root/repo/_debug_build/tests/zone-tests" "-g" "sort" "-t" "external_sort")
+set_tests_properties(external_sort PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(batches_match_records "/root/repo/_debug_build/tests/zone-tests" "-g" "batch" "-t" "batches_match_records")
+set_tests_properties(batches_match_records PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(batch_excludes_partition "/root/repo/_debug_build/tests/zone-tests" "-g" "batch" "-t" "batch_excludes_partition")
+set_tests_properties(batch_excludes_partition PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(positive_batch_continues "/root/repo/_debug_build/tests/zone-tests" "-g" "batch" "-t" "positive_batch_continues")
+set_tests_properties(positive_batch_continues PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(rrsets_group_records "/root/repo/_debug_build/tests/zone-tests" "-g" "rrset" "-t" "rrsets_group_records")
+set_tests_properties(rrsets_group_records PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(rrsets_split_by_buffers "/root/repo/_debug_build/tests/zone-tests" "-g" "rrset" "-t" "rrsets_split_by_buffers")
+set_tests_properties(rrsets_split_by_buffers PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(positive_rrset_continues "/root/repo/_debug_build/tests/zone-tests" "-g" "rrset" "-t" "positive_rrset_continues")
+set_tests_properties(positive_rrset_continues PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(next_matches_accept "/root/repo/_debug_build/tests/zone-tests" "-g" "next" "-t" "next_matches_accept")
+set_tests_properties(next_matches_accept PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(positive_accept_continues "/root/repo/_debug_build/tests/zone-tests" "-g" "next" "-t" "positive_accept_continues")
+set_tests_properties(positive_accept_continues PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(filter_allowed_types "/root/repo/_debug_build/tests/zone-tests" "-g" "filter" "-t" "filter_allowed_types")
+set_tests_properties(filter_allowed_types PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(filter_denied_types "/root/repo/_debug_build/tests/zone-tests" "-g" "filter" "-t" "filter_denied_types")
+set_tests_properties(filter_denied_types PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(subtree_roots "/root/repo/_debug_build/tests/zone-tests" "-g" "subtree" "-t" "subtree_roots")
+set_tests_properties(subtree_roots PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(lazy_decode_on_demand "/root/repo/_debug_build/tests/zone-tests" "-g" "lazy" "-t" "lazy_decode_on_demand")
+set_tests_properties(lazy_decode_on_demand PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(lazy_matches_accept "/root/repo/_debug_build/tests/zone-tests" "-g" "lazy" "-t" "lazy_matches_accept")
+set_tests_properties(lazy_matches_accept PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(owner_hash "/root/repo/_debug_build/tests/zone-tests" "-g" "hash" "-t" "owner_hash")
+set_tests_properties(owner_hash PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(owner_labels "/root/repo/_debug_build/tests/zone-tests" "-g" "labels" "-t" "owner_labels")
+set_tests_properties(owner_labels PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(canonical_names "/root/repo/_debug_build/tests/zone-tests" "-g" "canonical" "-t" "canonical_names")
+set_tests_properties(canonical_names PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(reuse_parser_for_strings "/root/repo/_debug_build/tests/zone-tests" "-g" "reuse" "-t" "reuse_parser_for_strings")
+set_tests_properties(reuse_parser_for_strings PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(reuse_parser_for_files "/root/repo/_debug_build/tests/zone-tests" "-g" "reuse" "-t" "reuse_parser_for_files")
+set_tests_properties(reuse_parser_for_files PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(parse_single_rr "/root/repo/_debug_build/tests/zone-tests" "-g" "reuse" "-t" "parse_single_rr")
+set_tests_properties(parse_single_rr PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(parser_footprint "/root/repo/_debug_build/tests/zone-tests" "-g" "tapes" "-t" "parser_footprint")
+set_tests_properties(parser_footprint PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(share_tapes_between_includes "/root/repo/_debug_build/tests/zone-tests" "-g" "tapes" "-t" "share_tapes_between_includes")
+set_tests_properties(share_tapes_between_includes PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(parse_in_steps "/root/repo/_debug_build/tests/zone-tests" "-g" "step" "-t" "parse_in_steps")
+set_tests_properties(parse_in_steps PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(pack_into_arena "/root/repo/_debug_build/tests/zone-tests" "-g" "arena" "-t" "pack_into_arena")
+set_tests_properties(pack_into_arena PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(skip_owner "/root/repo/_debug_build/tests/zone-tests" "-g" "skip" "-t" "skip_owner")
+set_tests_properties(skip_owner PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(skip_subtree "/root/repo/_debug_build/tests/zone-tests" "-g" "skip" "-t" "skip_subtree")
+set_tests_properties(skip_subtree PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(estimate_records "/root/repo/_debug_build/tests/zone-tests" "-g" "estimate" "-t" "estimate_records")
+set_tests_properties(estimate_records PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(estimate_large_file "/root/repo/_debug_build/tests/zone-tests" "-g" "estimate" "-t" "estimate_large_file")
+set_tests_properties(estimate_large_file PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(peek_soa_in_string "/root/repo/_debug_build/tests/zone-tests" "-g" "peek" "-t" "peek_soa_in_string")
+set_tests_properties(peek_soa_in_string PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(peek_soa_in_file "/root/repo/_debug_build/tests/zone-tests" "-g" "peek" "-t" "peek_soa_in_file")
+set_tests_properties(peek_soa_in_file PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(allocate_with_callbacks "/root/repo/_debug_build/tests/zone-tests" "-g" "allocator" "-t" "allocate_with_callbacks")
+set_tests_properties(allocate_with_callbacks PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(switch_allocators "/root/repo/_debug_build/tests/zone-tests" "-g" "allocator" "-t" "switch_allocators")
+set_tests_properties(switch_allocators PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(invalid_field_diagnostic "/root/repo/_debug_build/tests/zone-tests" "-g" "diagnostics" "-t" "invalid_field_diagnostic")
+set_tests_properties(invalid_field_diagnostic PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(semantic_diagnostic "/root/repo/_debug_build/tests/zone-tests" "-g" "diagnostics" "-t" "semantic_diagnostic")
+set_tests_properties(semantic_diagnostic PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(logged_diagnostic "/root/repo/_debug_build/tests/zone-tests" "-g" "diagnostics" "-t" "logged_diagnostic")
+set_tests_properties(logged_diagnostic PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(template_kernel "/root/repo/_debug_build/tests/zone-tests" "-g" "template" "-t" "template_kernel")
+set_tests_properties(template_kernel PROPERTIES  DISABLED "FALSE" TIMEOUT "0" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/Findcmocka.cmake;583;add_test;/root/repo/tests/CMakeLists.txt;12;cmocka_add_tests;/root/repo/tests/CMakeLists.txt;0;")
@@ -0,0 +1,465 @@
+/*
+ * runner.c.in -- boilerplate test runner for cmocka CMake module
+ *
+ * Copyright (c) 2020-2023, Jeroen Koekkoek
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <cmocka.h>
+
+static struct {
+  int print_help;
+  const char *group_pattern;
+  const char *test_pattern;
+} options = { 0, "*", "*" };
+
+struct group {
+  const char *name;
+  const struct CMUnitTest *tests;
+  CMFixtureFunction setup;
+  CMFixtureFunction teardown;
+};
+
+/*
+ * Copied from Eclipse Cyclone DDS (src/cmake/Modules/CUnit/src/main.c.in)
+ * under the terms of the BSD-3-Clause license on January 19th 2020.
+ *
+ * Copyright (c) 2006 to 2018, ADLINK Technology Limited and others
+ */
+static int patmatch(const char *pat, const char *str)
+{
+  while (*pat) {
+    if (*pat == '?') {
+      /* any character will do */
+      if (*str++ == 0) {
+        return 0;
+      }
+      pat++;
+    } else if (*pat == '*') {
+      /* collapse a sequence of wildcards, requiring as many
+         characters in str as there are ?s in the sequence */
+      while (*pat == '*' || *pat == '?') {
+        if (*pat == '?' && *str++ == 0) {
+          return 0;
+        }
+        pat++;
+      }
+      /* try matching on all positions where str matches pat */
+      while (*str) {
+        if (*str == *pat && patmatch(pat+1, str+1)) {
+          return 1;
+        }
+        str++;
+      }
+      return *pat == 0;
+    } else {
+      /* only an exact match */
+      if (*str++ != *pat++) {
+        return 0;
+      }
+    }
+  }
+
+  return *str == 0;
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr, "Usage: %s OPTIONS\n", prog);
+  fprintf(stderr, "Try '%s -h' for more information\n", prog);
+}
+
+static void help(const char *prog)
+{
+  printf("Usage: %s [OPTIONS]\n", prog);
+  printf("\n");
+  printf("Options:\n");
+  printf("  -h           Show this help message and exit\n");
+  printf("  -g  PATTERN  Run only tests in suites matching pattern\n");
+  printf("  -t  PATTERN  Run only tests matching pattern\n");
+  printf("\n");
+}
+
+static int parse_options(int argc, char *argv[])
+{
+  int err = 0;
+
+  for (int i = 1; err == 0 && i < argc; i++) {
+    switch ((argv[i][0] == '-') ? argv[i][1] : 0) {
+      case 'h':
+        options.print_help = 1;
+        break;
+      case 'g':
+        if ((i+1) < argc) {
+          options.group_pattern = argv[++i];
+          break;
+        }
+        /* fall through */
+      case 't':
+        if ((i+1) < argc) {
+          options.test_pattern = argv[++i];
+          break;
+        }
+        /* fall through */
+      default:
+        err = 1;
+        break;
+    }
+  }
+
+  return err;
+}
+
+extern int setup(void **state);
+extern int teardown(void **state);
+extern void supported_types(void **state);
+extern void include_from_string(void **state);
+extern void the_file_that_wasnt(void **state);
+extern void the_include_that_wasnt(void **state);
+extern void in_too_deep(void **state);
+extern void been_there_done_that(void **state);
+extern void include_relative(void **state);
+extern void track_includes(void **state);
+extern void ipv4_syntax(void **state);
+extern void time_stamp_syntax(void **state);
+extern void base16_syntax(void **state);
+extern void base32_syntax(void **state);
+extern void rfc9460_test_vectors(void **state);
+extern void newlines(void **state);
+extern void strings(void **state);
+extern void names(void **state);
+extern void ttls(void **state);
+extern void who_dis(void **state);
+extern void quote_no_unquote(void **state);
+extern void not_so_famous_last_words(void **state);
+extern void no_famous_last_words(void **state);
+extern void bad_a_rrs(void **state);
+extern void bad_ttls(void **state);
+extern void bad_origins(void **state);
+extern void bad_includes(void **state);
+extern void include_with_origin(void **state);
+extern void include_without_origin(void **state);
+extern void owner_is_reinstated(void **state);
+extern void origin_is_reinstated(void **state);
+extern void contiguous_escaped_start(void **state);
+extern void quoted_escaped_start(void **state);
+extern void contiguous_escaped_reset(void **state);
+extern void ds_digest_lengths(void **state);
+extern void zonemd_digest_lengths(void **state);
+extern void dsync_scheme_types(void **state);
+extern void eui48_and_eui64(void **state);
+extern void block_boundary(void **state);
+extern void contiguous_on_buffer_boundary(void **state);
+extern void test_trailing_zeroes(void **state);
+extern void test_leading_zeroes(void **state);
+extern void test_prefix_xor(void **state);
+extern void test_add_overflow(void **state);
+extern void correct_ttl_is_used(void **state);
+extern void correct_ttl_is_used_in_include(void **state);
+extern void owners_map_to_same_partition(void **state);
+extern void partition_requires_callback(void **state);
+extern void resume_from_every_checkpoint(void **state);
+extern void canonical_name_order(void **state);
+extern void canonical_rr_order(void **state);
+extern void sort_slices(void **state);
+extern void external_sort(void **state);
+extern void batches_match_records(void **state);
+extern void batch_excludes_partition(void **state);
+extern void positive_batch_continues(void **state);
+extern void rrsets_group_records(void **state);
+extern void rrsets_split_by_buffers(void **state);
+extern void positive_rrset_continues(void **state);
+extern void next_matches_accept(void **state);
+extern void positive_accept_continues(void **state);
+extern void filter_allowed_types(void **state);
+extern void filter_denied_types(void **state);
+extern void subtree_roots(void **state);
+extern void lazy_decode_on_demand(void **state);
+extern void lazy_matches_accept(void **state);
+extern void owner_hash(void **state);
+extern void owner_labels(void **state);
+extern void canonical_names(void **state);
+extern void reuse_parser_for_strings(void **state);
+extern void reuse_parser_for_files(void **state);
+extern void parse_single_rr(void **state);
+extern void parser_footprint(void **state);
+extern void share_tapes_between_includes(void **state);
+extern void parse_in_steps(void **state);
+extern void pack_into_arena(void **state);
+extern void skip_owner(void **state);
+extern void skip_subtree(void **state);
+extern void estimate_records(void **state);
+extern void estimate_large_file(void **state);
+extern void peek_soa_in_string(void **state);
+extern void peek_soa_in_file(void **state);
+extern void allocate_with_callbacks(void **state);
+extern void switch_allocators(void **state);
+extern void invalid_field_diagnostic(void **state);
+extern void semantic_diagnostic(void **state);
+extern void logged_diagnostic(void **state);
+extern void template_kernel(void **state);
+
+static const struct CMUnitTest types [] = {
+  cmocka_unit_test_setup_teardown(supported_types, NULL, NULL)
+};
+
+static const struct CMUnitTest include [] = {
+  cmocka_unit_test_setup_teardown(include_from_string, setup, teardown),
+  cmocka_unit_test_setup_teardown(the_file_that_wasnt, NULL, NULL),
+  cmocka_unit_test_setup_teardown(the_include_that_wasnt, NULL, NULL),
+  cmocka_unit_test_setup_teardown(in_too_deep, NULL, NULL),
+  cmocka_unit_test_setup_teardown(been_there_done_that, NULL, NULL),
+  cmocka_unit_test_setup_teardown(include_relative, NULL, NULL),
+  cmocka_unit_test_setup_teardown(track_includes, NULL, NULL)
+};
+
+static const struct CMUnitTest ip4 [] = {
+  cmocka_unit_test_setup_teardown(ipv4_syntax, NULL, NULL)
+};
+
+static const struct CMUnitTest time [] = {
+  cmocka_unit_test_setup_teardown(time_stamp_syntax, NULL, NULL)
+};
+
+static const struct CMUnitTest base16 [] = {
+  cmocka_unit_test_setup_teardown(base16_syntax, NULL, NULL)
+};
+
+static const struct CMUnitTest base32 [] = {
+  cmocka_unit_test_setup_teardown(base32_syntax, NULL, NULL)
+};
+
+static const struct CMUnitTest svcb [] = {
+  cmocka_unit_test_setup_teardown(rfc9460_test_vectors, NULL, NULL)
+};
+
+static const struct CMUnitTest syntax [] = {
+  cmocka_unit_test_setup_teardown(newlines, NULL, NULL),
+  cmocka_unit_test_setup_teardown(strings, NULL, NULL),
+  cmocka_unit_test_setup_teardown(names, NULL, NULL),
+  cmocka_unit_test_setup_teardown(ttls, NULL, NULL),
+  cmocka_unit_test_setup_teardown(who_dis, NULL, NULL),
+  cmocka_unit_test_setup_teardown(quote_no_unquote, NULL, NULL),
+  cmocka_unit_test_setup_teardown(not_so_famous_last_words, NULL, NULL),
+  cmocka_unit_test_setup_teardown(no_famous_last_words, NULL, NULL),
+  cmocka_unit_test_setup_teardown(bad_a_rrs, NULL, NULL),
+  cmocka_unit_test_setup_teardown(bad_ttls, NULL, NULL),
+  cmocka_unit_test_setup_teardown(bad_origins, NULL, NULL),
+  cmocka_unit_test_setup_teardown(bad_includes, NULL, NULL),
+  cmocka_unit_test_setup_teardown(include_with_origin, NULL, NULL),
+  cmocka_unit_test_setup_teardown(include_without_origin, NULL, NULL),
+  cmocka_unit_test_setup_teardown(owner_is_reinstated, NULL, NULL),
+  cmocka_unit_test_setup_teardown(origin_is_reinstated, NULL, NULL),
+  cmocka_unit_test_setup_teardown(contiguous_escaped_start, NULL, NULL),
+  cmocka_unit_test_setup_teardown(quoted_escaped_start, NULL, NULL),
+  cmocka_unit_test_setup_teardown(contiguous_escaped_reset, NULL, NULL)
+};
+
+static const struct CMUnitTest semantics [] = {
+  cmocka_unit_test_setup_teardown(ds_digest_lengths, NULL, NULL),
+  cmocka_unit_test_setup_teardown(zonemd_digest_lengths, NULL, NULL),
+  cmocka_unit_test_setup_teardown(dsync_scheme_types, NULL, NULL)
+};
+
+static const struct CMUnitTest eui [] = {
+  cmocka_unit_test_setup_teardown(eui48_and_eui64, NULL, NULL)
+};
+
+static const struct CMUnitTest bounds [] = {
+  cmocka_unit_test_setup_teardown(block_boundary, NULL, NULL),
+  cmocka_unit_test_setup_teardown(contiguous_on_buffer_boundary, NULL, NULL)
+};
+
+static const struct CMUnitTest bits [] = {
+  cmocka_unit_test_setup_teardown(test_trailing_zeroes, NULL, NULL),
+  cmocka_unit_test_setup_teardown(test_leading_zeroes, NULL, NULL),
+  cmocka_unit_test_setup_teardown(test_prefix_xor, NULL, NULL),
+  cmocka_unit_test_setup_teardown(test_add_overflow, NULL, NULL)
+};
+
+static const struct CMUnitTest ttl [] = {
+  cmocka_unit_test_setup_teardown(correct_ttl_is_used, NULL, NULL),
+  cmocka_unit_test_setup_teardown(correct_ttl_is_used_in_include, NULL, NULL)
+};
+
+static const struct CMUnitTest partition [] = {
+  cmocka_unit_test_setup_teardown(owners_map_to_same_partition, NULL, NULL),
+  cmocka_unit_test_setup_teardown(partition_requires_callback, NULL, NULL)
+};
+
+static const struct CMUnitTest checkpoint [] = {
+  cmocka_unit_test_setup_teardown(resume_from_every_checkpoint, NULL, NULL)
+};
+
+static const struct CMUnitTest sort [] = {
+  cmocka_unit_test_setup_teardown(canonical_name_order, NULL, NULL),
+  cmocka_unit_test_setup_teardown(canonical_rr_order, NULL, NULL),
+  cmocka_unit_test_setup_teardown(sort_slices, NULL, NULL),
+  cmocka_unit_test_setup_teardown(external_sort, NULL, NULL)
+};
+
+static const struct CMUnitTest batch [] = {
+  cmocka_unit_test_setup_teardown(batches_match_records, NULL, NULL),
+  cmocka_unit_test_setup_teardown(batch_excludes_partition, NULL, NULL),
+  cmocka_unit_test_setup_teardown(positive_batch_continues, NULL, NULL)
+};
+
+static const struct CMUnitTest rrset [] = {
+  cmocka_unit_test_setup_teardown(rrsets_group_records, NULL, NULL),
+  cmocka_unit_test_setup_teardown(rrsets_split_by_buffers, NULL, NULL),
+  cmocka_unit_test_setup_teardown(positive_rrset_continues, NULL, NULL)
+};
+
+static const struct CMUnitTest next [] = {
+  cmocka_unit_test_setup_teardown(next_matches_accept, NULL, NULL),
+  cmocka_unit_test_setup_teardown(positive_accept_continues, NULL, NULL)
+};
+
+static const struct CMUnitTest filter [] = {
+  cmocka_unit_test_setup_teardown(filter_allowed_types, NULL, NULL),
+  cmocka_unit_test_setup_teardown(filter_denied_types, NULL, NULL)
+};
+
+static const struct CMUnitTest subtree [] = {
+  cmocka_unit_test_setup_teardown(subtree_roots, NULL, NULL)
+};
+
+static const struct CMUnitTest lazy [] = {
+  cmocka_unit_test_setup_teardown(lazy_decode_on_demand, NULL, NULL),
+  cmocka_unit_test_setup_teardown(lazy_matches_accept, NULL, NULL)
+};
+
+static const struct CMUnitTest hash [] = {
+  cmocka_unit_test_setup_teardown(owner_hash, NULL, NULL)
+};
+
+static const struct CMUnitTest labels [] = {
+  cmocka_unit_test_setup_teardown(owner_labels, NULL, NULL)
+};
+
+static const struct CMUnitTest canonical [] = {
+  cmocka_unit_test_setup_teardown(canonical_names, NULL, NULL)
+};
+
+static const struct CMUnitTest reuse [] = {
+  cmocka_unit_test_setup_teardown(reuse_parser_for_strings, NULL, NULL),
+  cmocka_unit_test_setup_teardown(reuse_parser_for_files, NULL, NULL),
+  cmocka_unit_test_setup_teardown(parse_single_rr, NULL, NULL)
+};
+
+static const struct CMUnitTest tapes [] = {
+  cmocka_unit_test_setup_teardown(parser_footprint, NULL, NULL),
+  cmocka_unit_test_setup_teardown(share_tapes_between_includes, NULL, NULL)
+};
+
+static const struct CMUnitTest step [] = {
+  cmocka_unit_test_setup_teardown(parse_in_steps, NULL, NULL)
+};
+
+static const struct CMUnitTest arena [] = {
+  cmocka_unit_test_setup_teardown(pack_into_arena, NULL, NULL)
+};
+
+static const struct CMUnitTest skip [] = {
+  cmocka_unit_test_setup_teardown(skip_owner, NULL, NULL),
+  cmocka_unit_test_setup_teardown(skip_subtree, NULL, NULL)
+};
+
+static const struct CMUnitTest estimate [] = {
+  cmocka_unit_test_setup_teardown(estimate_records, NULL, NULL),
+  cmocka_unit_test_setup_teardown(estimate_large_file, NULL, NULL)
+};
+
+static const struct CMUnitTest peek [] = {
+  cmocka_unit_test_setup_teardown(peek_soa_in_string, NULL, NULL),
+  cmocka_unit_test_setup_teardown(peek_soa_in_file, NULL, NULL)
+};
+
+static const struct CMUnitTest allocator [] = {
+  cmocka_unit_test_setup_teardown(allocate_with_callbacks, NULL, NULL),
+  cmocka_unit_test_setup_teardown(switch_allocators, NULL, NULL)
+};
+
+static const struct CMUnitTest diagnostics [] = {
+  cmocka_unit_test_setup_teardown(invalid_field_diagnostic, NULL, NULL),
+  cmocka_unit_test_setup_teardown(semantic_diagnostic, NULL, NULL),
+  cmocka_unit_test_setup_teardown(logged_diagnostic, NULL, NULL)
+};
+
+static const struct CMUnitTest template [] = {
+  cmocka_unit_test_setup_teardown(template_kernel, NULL, NULL)
+};
+
+#define exec_tests(group, setup, teardown) \
+  do { \
+    if (patmatch(options.group_pattern, #group)) { \
+      cnt += cmocka_run_group_tests(group, setup, teardown); \
+    } \
+  } while(0)
+
+int main(int argc, char *argv[])
+{
+  int cnt = 0; /* number of failed tests */
+  char *prog = argv[0];
+
+  for (char *sep = argv[0]; *sep; sep++) {
+    if (*sep == '/' || *sep == '\\') {
+      prog = sep + 1;
+    }
+  }
+
+  if (parse_options(argc, argv) != 0) {
+    usage(prog);
+    return 1;
+  } else if (options.print_help) {
+    help(prog);
+    return 0;
+  }
+
+  cmocka_set_test_filter(options.test_pattern);
+
+exec_tests(types, NULL, NULL);
+exec_tests(include, NULL, NULL);
+exec_tests(ip4, NULL, NULL);
+exec_tests(time, NULL, NULL);
+exec_tests(base16, NULL, NULL);
+exec_tests(base32, NULL, NULL);
+exec_tests(svcb, NULL, NULL);
+exec_tests(syntax, NULL, NULL);
+exec_tests(semantics, NULL, NULL);
+exec_tests(eui, NULL, NULL);
+exec_tests(bounds, NULL, NULL);
+exec_tests(bits, NULL, NULL);
+exec_tests(ttl, NULL, NULL);
+exec_tests(partition, NULL, NULL);
+exec_tests(checkpoint, NULL, NULL);
+exec_tests(sort, NULL, NULL);
+exec_tests(batch, NULL, NULL);
+exec_tests(rrset, NULL, NULL);
+exec_tests(next, NULL, NULL);
+exec_tests(filter, NULL, NULL);
+exec_tests(subtree, NULL, NULL);
+exec_tests(lazy, NULL, NULL);
+exec_tests(hash, NULL, NULL);
+exec_tests(labels, NULL, NULL);
+exec_tests(canonical, NULL, NULL);
+exec_tests(reuse, NULL, NULL);
+exec_tests(tapes, NULL, NULL);
+exec_tests(step, NULL, NULL);
+exec_tests(arena, NULL, NULL);
+exec_tests(skip, NULL, NULL);
+exec_tests(estimate, NULL, NULL);
+exec_tests(peek, NULL, NULL);
+exec_tests(allocator, NULL, NULL);
+exec_tests(diagnostics, NULL, NULL);
+exec_tests(template, NULL, NULL);
+
+  return (cnt != 0);
+}
@@ -311,6 +311,21 @@ struct zone_rdata_buffer {
  */
 #define ZONE_TAPE_SIZE ((100 * ZONE_BLOCK_SIZE) + ZONE_BLOCK_SIZE)
 
+/**
+ * @private
+ *
+ * Tapes are allocated on demand and sized for the input, the capacity never
+ * exceeds @ref ZONE_TAPE_SIZE. Only the active file requires tapes, they are
+ * shared between include levels where possible.
+ */
+typedef struct zone_tapes zone_tapes_t;
+struct zone_tapes {
+  size_t size;
+  const char **fields;
+  const char **delimiters;
+  uint16_t *newlines;
+};
+
 typedef struct zone_file zone_file_t;
 struct zone_file {
   /** @private */
@@ -352,9 +367,18 @@ struct zone_file {
   /** @private */
   struct {
     size_t index, length, size;
+    /** offset of data in file */
+    uint64_t offset;
     char *data;
   } buffer;
   /** @private */
+  struct {
+    /** offset of last checkpoint */
+    uint64_t last;
+    /** offset of first line after $INCLUDE entry (includer only) */
+    uint64_t resume;
+  } checkpoint;
+  /** @private */
   /** scanner state is kept per-file */
   struct {
     uint64_t in_comment;
@@ -363,11 +387,16 @@ struct zone_file {
     uint64_t follows_contiguous;
   } state;
   /** @private */
+  zone_tapes_t *tapes;
+  /** @private */
+  /** index to rescan from after tapes are handed back by included file */
+  size_t rescan;
+  /** @private */
   /** vector of tokens generated by the scanner guaranteed to be large
       enough to hold every token for a single read + terminators */
-  struct { const char **head, **tail, *tape[ZONE_TAPE_SIZE + 2]; } fields;
-  struct { const char **head, **tail, *tape[ZONE_TAPE_SIZE + 1]; } delimiters;
-  struct { uint16_t *head, *tail, tape[ZONE_TAPE_SIZE + 1]; } newlines;
+  struct { const char **head, **tail, **tape; } fields;
+  struct { const char **head, **tail, **tape; } delimiters;
+  struct { uint16_t *head, *tail, *tape; } newlines;
 };
 
 typedef struct zone_parser zone_parser_t;
@@ -390,6 +419,46 @@ typedef void(*zone_log_t)(
   const char *, // message
   void *); // user data
 
+/**
+ * @brief Diagnostic passed to structured diagnostic callback.
+ *
+ * The message is not formatted unless @ref zone_format_diagnostic is
+ * invoked. Diagnostics are only valid for the duration of the callback.
+ */
+typedef struct zone_diagnostic zone_diagnostic_t;
+struct zone_diagnostic {
+  /** Priority, i.e. @ref ZONE_ERROR, @ref ZONE_WARNING or @ref ZONE_INFO. */
+  uint32_t priority;
+  /** Return code associated with diagnostic, e.g. @ref ZONE_SYNTAX_ERROR.
+      0 if the diagnostic is not associated with a return code. */
+  int32_t code;
+  /** Name of invalid field, e.g. "address". NULL if not applicable, e.g.
+      if the RDATA is invalid as a whole. */
+  const char *field;
+  /** Name of type the field belongs to, e.g. "A". NULL if not applicable. */
+  const char *type;
+  /** Name of file. NULL if initial file does not exist. */
+  const char *file;
+  /** Line number. */
+  size_t line;
+  /** Offset in octets of last token read. */
+  uint64_t offset;
+  /** @private */
+  const char *format;
+  /** @private */
+  void *arguments;
+};
+
+/**
+ * @brief Signature of callback function that is invoked for diagnostics.
+ *
+ * Invoked instead of the log callback if set.
+ */
+typedef void(*zone_diagnose_t)(
+  zone_parser_t *,
+  const zone_diagnostic_t *,
+  void *); // user data
+
 /**
  * @brief Domain name and corresponding length in wire format.
  */
@@ -401,10 +470,50 @@ struct zone_name {
   const uint8_t *octets;
 };
 
+/** Maximum number of labels in a domain name, including the root label. */
+#define ZONE_MAX_LABELS (128)
+
+/**
+ * @brief Offsets of labels in a domain name in wire format.
+ */
+typedef struct zone_labels zone_labels_t;
+struct zone_labels {
+  /** Number of labels, including the root label. */
+  uint8_t count;
+  /** Offset of each label, from left to right. */
+  uint8_t offsets[ZONE_MAX_LABELS];
+};
+
+/**
+ * @brief Resource record.
+ *
+ * Header is in host order, RDATA section is in network order.
+ */
+typedef struct zone_rr zone_rr_t;
+struct zone_rr {
+  /** Owner (length + octets). */
+  zone_name_t owner;
+  /** Type. */
+  uint16_t type;
+  /** Class. */
+  uint16_t class;
+  /** Time to live. */
+  uint32_t ttl;
+  /** Length of RDATA section. */
+  uint16_t rdlength;
+  /** RDATA section. */
+  const uint8_t *rdata;
+};
+
 /**
  * @brief Signature of callback function invoked for each RR.
  *
  * Header is in host order, RDATA section is in network order.
+ *
+ * A negative value stops parsing and is returned by the parse function.
+ * Positive values do not stop parsing, except in @ref zone_parse_step, and
+ * are returned by the parse function if returned for the last RR.
+ * @ref ZONE_SKIP_OWNER and @ref ZONE_SKIP_SUBTREE skip the RRs that follow.
  */
 typedef int32_t(*zone_accept_t)(
   zone_parser_t *,
@@ -416,6 +525,267 @@ typedef int32_t(*zone_accept_t)(
   const uint8_t *, // rdata
   void *); // user data
 
+/**
+ * @brief Signature of callback function invoked for each RR if RRs are
+ *        partitioned by owner.
+ *
+ * Identical to @ref zone_accept_t, but for the partition the RR is routed
+ * to. All RRs that share an owner are routed to the same partition in the
+ * order they appear in the zone, which allows for delivery to a set of
+ * (single producer) queues, one per consumer, without locking a shared data
+ * structure.
+ */
+typedef int32_t(*zone_partition_t)(
+  zone_parser_t *,
+  size_t, // partition
+  const zone_name_t *, // owner (length + octets)
+  uint16_t, // type
+  uint16_t, // class
+  uint32_t, // ttl
+  uint16_t, // rdlength
+  const uint8_t *, // rdata
+  void *); // user data
+
+/** Maximum number of RRs in a batch. */
+#define ZONE_BATCH_SIZE (256)
+
+/**
+ * @brief Batch of RRs as a structure of arrays.
+ *
+ * Headers are in host order, RDATA sections are in network order.
+ */
+typedef struct zone_batch zone_batch_t;
+struct zone_batch {
+  /** Number of RRs in batch. */
+  size_t count;
+  /** Owners (length + octets). */
+  zone_name_t owners[ZONE_BATCH_SIZE];
+  /** Types. */
+  uint16_t types[ZONE_BATCH_SIZE];
+  /** Classes. */
+  uint16_t classes[ZONE_BATCH_SIZE];
+  /** Time to live for each RR. */
+  uint32_t ttls[ZONE_BATCH_SIZE];
+  /** Lengths of RDATA sections. */
+  uint16_t rdlengths[ZONE_BATCH_SIZE];
+  /** RDATA sections. */
+  const uint8_t *rdata[ZONE_BATCH_SIZE];
+  /** Owner hashes if hash_owners is set, see @ref zone_owner_hash. */
+  uint32_t hashes[ZONE_BATCH_SIZE];
+};
+
+/**
+ * @brief Signature of callback function invoked for each batch of RRs.
+ *
+ * Owners and RDATA sections reside in the scratch buffers passed to the
+ * parser and remain valid for the duration of the callback. Consecutive RRs
+ * that share an owner share the octets pointer.
+ *
+ * Return values are treated like those of @ref zone_accept_t, except that
+ * skip codes are not supported. A positive value is returned by the parse
+ * function if returned for the last batch.
+ */
+typedef int32_t(*zone_accept_batch_t)(
+  zone_parser_t *,
+  const zone_batch_t *,
+  void *); // user data
+
+/**
+ * @brief RRset, i.e. consecutive RRs that share owner, type and class.
+ *
+ * Header is in host order, RDATA sections are in network order.
+ */
+typedef struct zone_rrset zone_rrset_t;
+struct zone_rrset {
+  /** Owner (length + octets). */
+  zone_name_t owner;
+  /** Type. */
+  uint16_t type;
+  /** Class. */
+  uint16_t class;
+  /** Owner hash if hash_owners is set, see @ref zone_owner_hash. */
+  uint32_t hash;
+  /** Owner labels if owner_labels is set, see @ref zone_owner_labels. */
+  zone_labels_t labels;
+  /** Number of RRs in RRset. */
+  size_t count;
+  /** Time to live for each RR. */
+  uint32_t ttls[ZONE_BATCH_SIZE];
+  /** Lengths of RDATA sections. */
+  uint16_t rdlengths[ZONE_BATCH_SIZE];
+  /** RDATA sections. */
+  const uint8_t *rdata[ZONE_BATCH_SIZE];
+};
+
+/**
+ * @brief Signature of callback function invoked for each RRset.
+ *
+ * Owner and RDATA sections reside in the scratch buffers passed to the
+ * parser and remain valid for the duration of the callback. RRsets that
+ * hold more RRs than there are scratch buffers, or that span a checkpoint,
+ * are delivered in parts by consecutive invocations.
+ *
+ * Return values are treated like those of @ref zone_accept_t, except that
+ * skip codes are not supported. A positive value is returned by the parse
+ * function if returned for the last RRset.
+ */
+typedef int32_t(*zone_accept_rrset_t)(
+  zone_parser_t *,
+  const zone_rrset_t *,
+  void *); // user data
+
+/**
+ * @brief Handle to undecoded RDATA of an RR.
+ *
+ * Refers to the presentation format tokens of the RDATA section, which are
+ * decoded on demand by @ref zone_decode_rdata.
+ *
+ * @warning Do not modify directly.
+ */
+typedef struct zone_lazy_rdata zone_lazy_rdata_t;
+struct zone_lazy_rdata {
+  /** @private */
+  zone_parser_t *parser;
+  /** @private */
+  const void *type;
+  /** @private */
+  int32_t (*decode)(zone_lazy_rdata_t *, zone_rdata_buffer_t *);
+  /** @private */
+  struct {
+    const char **fields, **delimiters;
+    uint16_t *newlines;
+    size_t span, line;
+    bool grouped, start_of_line;
+  } tape;
+  /** @private */
+  const uint8_t *octets;
+  /** @private */
+  uint16_t length;
+};
+
+/**
+ * @brief Signature of callback function invoked for each RR if RDATA is
+ *        decoded on demand.
+ *
+ * Identical to @ref zone_accept_t, but RDATA is passed as a handle that
+ * remains valid for the duration of the callback.
+ */
+typedef int32_t(*zone_accept_lazy_t)(
+  zone_parser_t *,
+  const zone_name_t *, // owner (length + octets)
+  uint16_t, // type
+  uint16_t, // class
+  uint32_t, // ttl
+  zone_lazy_rdata_t *, // rdata
+  void *); // user data
+
+/**
+ * @brief RR packed into an arena.
+ *
+ * RRs are stored back-to-back at offsets aligned to four octets. The owner
+ * is stored once, length-prefixed, directly following the RDATA section of
+ * the first RR that references it.
+ */
+typedef struct zone_packed_rr zone_packed_rr_t;
+struct zone_packed_rr {
+  /** Offset of owner (length + octets) in arena. */
+  uint32_t owner;
+  uint32_t ttl;
+  uint16_t type;
+  uint16_t class;
+  uint16_t rdlength;
+  uint8_t rdata[];
+};
+
+/**
+ * @brief Minimum number of free octets required to pack an RR.
+ *
+ * RDATA is decoded in place, the arena must hold an RR of maximum size
+ * (RDATA, owner and padding used by vector instructions).
+ */
+#define ZONE_ARENA_RESERVE \
+  (16 + ZONE_RDATA_SIZE + ZONE_BLOCK_SIZE + 1 + ZONE_NAME_SIZE + 3)
+
+/**
+ * @brief Arena RRs are packed into.
+ */
+typedef struct zone_arena zone_arena_t;
+struct zone_arena {
+  /** Memory, aligned to at least four octets. */
+  uint8_t *octets;
+  /** Size of memory. */
+  size_t size;
+  /** Number of octets in use, RRs are appended at length. */
+  size_t length;
+  /** Number of RRs in arena. */
+  size_t count;
+};
+
+/**
+ * @brief Signature of callback function invoked if arena is full.
+ *
+ * Consume RRs and reset the arena, or grow it, so that at least the given
+ * number of octets is available. Owners stored before the callback are
+ * referenced afterwards only if length is unchanged, i.e. if the arena was
+ * resized.
+ */
+typedef int32_t(*zone_grow_arena_t)(
+  zone_parser_t *,
+  zone_arena_t *,
+  size_t, // number of octets required
+  void *); // user data
+
+/**
+ * @brief Parser state of a single file in a checkpoint.
+ */
+typedef struct zone_checkpoint_file zone_checkpoint_file_t;
+struct zone_checkpoint_file {
+  /** Absolute path of file. */
+  const char *path;
+  /** Offset of first line not yet parsed. */
+  uint64_t offset;
+  /** Line number at offset. */
+  size_t line;
+  /** Origin in effect at offset. */
+  zone_name_t origin;
+  /** Last stated owner. */
+  zone_name_t owner;
+  /** Last stated CLASS. */
+  uint16_t last_class;
+  /** Last stated TTL. */
+  uint32_t last_ttl;
+  /** Last parsed TTL in $TTL entry. */
+  uint32_t dollar_ttl;
+  /** Whether or not a $TTL entry is in effect. */
+  bool has_dollar_ttl;
+};
+
+/**
+ * @brief Parser state required to resume parsing at a record boundary.
+ *
+ * A checkpoint describes the include stack, i.e. the top-level file and
+ * every file included from there, at the start of a line. Parsing can be
+ * resumed from the checkpoint using @ref zone_resume.
+ */
+typedef struct zone_checkpoint zone_checkpoint_t;
+struct zone_checkpoint {
+  /** Number of files in include stack. */
+  size_t depth;
+  /** Files in include stack, top-level file first. */
+  const zone_checkpoint_file_t *files;
+};
+
+/**
+ * @brief Signature of callback function invoked for each checkpoint.
+ *
+ * Checkpoint data is only valid for the duration of the callback and must
+ * be copied, e.g. to a sidecar index, by the application.
+ */
+typedef int32_t(*zone_save_checkpoint_t)(
+  zone_parser_t *,
+  const zone_checkpoint_t *,
+  void *); // user data
+
 /**
  * @brief Signature of callback function invoked on $INCLUDE.
  *
@@ -428,6 +798,40 @@ typedef int32_t(*zone_include_t)(
   const char *, // fully qualified path
   void *); // user data
 
+/**
+ * @brief Signature of callback function invoked to allocate memory.
+ */
+typedef void *(*zone_allocate_t)(
+  void *, // context
+  size_t); // size
+
+/**
+ * @brief Signature of callback function invoked to resize memory.
+ */
+typedef void *(*zone_reallocate_t)(
+  void *, // context
+  void *, // pointer
+  size_t); // size
+
+/**
+ * @brief Signature of callback function invoked to release memory.
+ */
+typedef void(*zone_release_t)(
+  void *, // context
+  void *); // pointer
+
+/**
+ * @brief Signature of parse function generated in template mode.
+ *
+ * Applications may compile a kernel (e.g. src/haswell/parser.c) into their
+ * own translation unit with ZONE_ACCEPT defined as the name of the accept
+ * function and ZONE_PARSE defined as the name of the parse function to
+ * generate. RRs are then delivered to ZONE_ACCEPT directly, which allows
+ * the compiler to inline it. The generated function is passed to the parser
+ * through @ref zone_options_t.kernel.
+ */
+typedef int32_t(*zone_kernel_t)(zone_parser_t *);
+
 /**
  * @brief Available configuration options.
  */
@@ -444,6 +848,17 @@ typedef struct {
   uint32_t include_limit;
   /** Enable 1h2m3s notations for TTLS. */
   bool pretty_ttls;
+  /** Convert names to canonical form (RFC 4034 section 6.2). */
+  /** Owners, and names in RDATA of types listed in RFC 4034 section 6.2
+      (excluding NSEC as per RFC 6840 section 5.1), are converted to
+      lowercase. RDATA in generic (RFC 3597) notation is not converted. */
+  bool canonical;
+  /** Hash owners, see @ref zone_owner_hash. */
+  /** Owners are hashed once per stated owner. Implied by partition. */
+  bool hash_owners;
+  /** Index owner labels, see @ref zone_owner_labels. */
+  /** Labels are indexed once per stated owner. */
+  bool owner_labels;
   /** Origin in wire format. */
   zone_name_t origin;
   /** Default TTL to use. */
@@ -455,22 +870,106 @@ typedef struct {
     uint32_t mask;
     /** Callback invoked to write out log messages. */
     zone_log_t callback;
+    /** Callback invoked for diagnostics instead of log callback. */
+    /** Messages are only formatted if @ref zone_format_diagnostic is
+        invoked. */
+    zone_diagnose_t diagnose;
   } log;
   struct {
     /** Callback invoked for each RR. */
+    /** Not required if RRs are retrieved using @ref zone_next. Return
+        @ref ZONE_SKIP_OWNER or @ref ZONE_SKIP_SUBTREE to skip RRs that
+        follow without decoding RDATA. */
     zone_accept_t callback;
   } accept;
+  struct {
+    /** Callback invoked for each RR instead of accept callback. */
+    /** RDATA is only decoded if @ref zone_decode_rdata is invoked. */
+    zone_accept_lazy_t callback;
+  } lazy;
+  struct {
+    /** Types of RRs to accept, or to skip if deny is set. */
+    /** RDATA of skipped RRs is not decoded, only the owner, TTL, class and
+        type are verified. Useful if only a subset of types is of interest,
+        e.g. delegations in a signed zone. */
+    const uint16_t *types;
+    /** Number of types. 0 to disable. */
+    size_t count;
+    /** Skip listed types instead of accepting only listed types. */
+    bool deny;
+  } filter;
+  struct {
+    /** Roots (in wire format) of subtrees to accept RRs from. */
+    /** RRs with an owner that is not at or below any of the roots are
+        skipped without decoding RDATA. */
+    const zone_name_t *roots;
+    /** Number of roots. 0 to disable. */
+    size_t count;
+  } subtree;
   struct {
     /** Callback invoked for each $INCLUDE entry. */
     zone_include_t callback;
   } include;
+  struct {
+    /** Callback invoked to allocate memory, like malloc. */
+    /** Either all or none of the allocator callbacks must be set, malloc,
+        realloc and free are used if none are set. */
+    zone_allocate_t allocate;
+    /** Callback invoked to resize memory, like realloc. */
+    zone_reallocate_t reallocate;
+    /** Callback invoked to release memory, like free. Never invoked for
+        NULL. */
+    zone_release_t release;
+    /** Pointer passed verbatim to allocator callbacks. */
+    void *context;
+  } allocator;
+  /** Parse function generated in template mode, see @ref zone_kernel_t. */
+  /** The accept callback is not required if set. NULL selects the kernel
+      best suited for the CPU. */
+  zone_kernel_t kernel;
+  struct {
+    /** Callback invoked for batches of RRs instead of accept callback. */
+    /** A batch holds at most as many RRs as there are scratch buffers, up
+        to @ref ZONE_BATCH_SIZE. */
+    zone_accept_batch_t callback;
+  } batch;
+  struct {
+    /** Callback invoked for each RRset instead of accept callback. */
+    /** Owners are compared case-insensitively and only if stated, RRs with
+        a blank owner continue the RRset if type and class match. */
+    zone_accept_rrset_t callback;
+  } rrset;
+  struct {
+    /** Arena to pack RRs into instead of invoking accept callback. */
+    /** RDATA is decoded directly into the arena, the scratch buffers are
+        only used for owners. */
+    zone_arena_t *arena;
+    /** Callback invoked if fewer than @ref ZONE_ARENA_RESERVE octets are
+        available. Parsing fails if not set and the arena is full. */
+    zone_grow_arena_t callback;
+  } arena;
+  struct {
+    /** Number of partitions to distribute RRs over. 0 to disable. */
+    /** RRs are routed by a case-insensitive hash of the owner, which is
+        computed once for each stated owner. */
+    size_t count;
+    /** Callback invoked for each RR instead of accept callback. */
+    zone_partition_t callback;
+  } partition;
+  struct {
+    /** Minimum number of bytes between checkpoints. 0 to disable. */
+    /** Checkpoints are taken at record boundaries and only for files. */
+    uint64_t interval;
+    /** Callback invoked for each checkpoint. */
+    zone_save_checkpoint_t callback;
+  } checkpoint;
 } zone_options_t;
 
 /**
  * @brief Scratch buffer space reserved for parser.
  *
- * @note Future versions may leverage multiple buffers to improve throughput
- *       as parsing and committing resource records are disjunct operations.
+ * @note Multiple buffers are used if RRs are delivered in batches, every RR
+ *       in a batch occupies a buffer.
  */
 typedef struct zone_buffers zone_buffers_t;
 struct zone_buffers {
@@ -507,6 +1006,49 @@ struct zone_parser {
   /** @private */
   zone_rdata_buffer_t *rdata;
   /** @private */
+  bool custom_delivery;
+  /** @private */
+  bool owner_stated;
+  /** @private */
+  zone_batch_t *batch;
+  /** @private */
+  zone_rrset_t *rrset;
+  /** @private */
+  zone_rr_t *rr;
+  /** @private */
+  size_t budget;
+  /** @private */
+  size_t packed_owner;
+  /** @private */
+  uint64_t filter[4];
+  /** @private */
+  bool out_of_scope;
+  /** @private */
+  struct {
+    int32_t code;
+    zone_name_buffer_t owner;
+  } skip;
+  /** @private */
+  zone_lazy_rdata_t *lazy;
+  /** @private */
+  zone_kernel_t kernel;
+  /** @private */
+  bool hash_owners;
+  /** @private */
+  uint32_t owner_hash;
+  /** @private */
+  zone_labels_t labels;
+  /** @private */
+  /** window and tapes are retained between zones by reusable parsers */
+  struct {
+    bool retain;
+    struct {
+      char *data;
+      size_t size;
+    } window;
+    zone_tapes_t *tapes;
+  } cache;
+  /** @private */
   zone_file_t *file, first;
 };
 
@@ -533,6 +1075,14 @@ struct zone_parser {
 #define ZONE_NOT_A_FILE (-1792)  // (-7 << 8)
 /** Access to specified file is not allowed. */
 #define ZONE_NOT_PERMITTED (-2048)  // (-8 << 8)
+/** Error writing temporary file. */
+#define ZONE_WRITE_ERROR (-2304)  // (-9 << 8)
+/** Budget exhausted, parsing continues on the next step. */
+#define ZONE_AGAIN (1)
+/** Skip remaining RRs with the same owner. Returned by accept callback. */
+#define ZONE_SKIP_OWNER (2)
+/** Skip remaining RRs at and below owner. Returned by accept callback. */
+#define ZONE_SKIP_SUBTREE (3)
 /** @} */
 
 /**
@@ -584,6 +1134,590 @@ zone_parse_string(
   void *user_data)
 zone_nonnull((1,2,3,4));
 
+/**
+ * @brief Estimated size of zone.
+ *
+ * Counts are approximate, tokens are counted without decoding RRs.
+ */
+typedef struct zone_estimate zone_estimate_t;
+struct zone_estimate {
+  /** Number of octets. */
+  uint64_t octets;
+  /** Number of lines. */
+  size_t lines;
+  /** Number of fields, excluding line feeds and braces. */
+  size_t fields;
+  /** Number of RRs, i.e. RRs with a stated owner plus RRs with a blank owner. */
+  size_t records;
+  /** Number of RRs with a stated owner. */
+  size_t owners;
+  /** Number of RRs with a blank owner. */
+  size_t blank_owners;
+  /** Number of fields that read RRSIG, i.e. number of signatures. */
+  size_t signatures;
+};
+
+/**
+ * @brief Estimate size of zone file
+ *
+ * Scan file to estimate the number of RRs, e.g. to size hash tables and
+ * arenas before parsing. Only the scanner runs, RRs are not decoded and
+ * $INCLUDE entries are not followed.
+ *
+ * @param[in]   parser    Zone parser
+ * @param[in]   options   Settings used for parsing.
+ * @param[in]   buffers   Scratch buffers used for parsing.
+ * @param[in]   path      Path of master file to scan.
+ * @param[out]  estimate  Estimated size of zone.
+ *
+ * @returns @ref ZONE_SUCCESS on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_estimate(
+  zone_parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const char *path,
+  zone_estimate_t *estimate)
+zone_nonnull_all;
+
+/**
+ * @brief Start of authority.
+ *
+ * Fields of the first SOA RR in a zone, names are in wire format.
+ */
+typedef struct zone_soa zone_soa_t;
+struct zone_soa {
+  /** Owner, i.e. apex of zone. */
+  zone_name_buffer_t owner;
+  /** Class. */
+  uint16_t class;
+  /** Time to live. */
+  uint32_t ttl;
+  /** Name of primary name server (MNAME). */
+  zone_name_buffer_t primary;
+  /** Mailbox of person responsible for zone (RNAME). */
+  zone_name_buffer_t mailbox;
+  /** Version of zone. */
+  uint32_t serial;
+  /** Refresh interval. */
+  uint32_t refresh;
+  /** Retry interval. */
+  uint32_t retry;
+  /** Expiry interval. */
+  uint32_t expire;
+  /** Minimum TTL, i.e. TTL for negative responses. */
+  uint32_t minimum;
+};
+
+/**
+ * @brief Retrieve SOA from zone file
+ *
+ * Parse input up to and including the first SOA RR, e.g. to compare its
+ * serial before loading the zone. RDATA of other RRs is not decoded and
+ * the remainder of the file is not read. Callbacks other than the log and
+ * include callbacks are ignored.
+ *
+ * @param[in]   parser   Zone parser
+ * @param[in]   options  Settings used for parsing.
+ * @param[in]   buffers  Scratch buffers used for parsing.
+ * @param[in]   path     Path of master file to parse.
+ * @param[out]  soa      Fields of first SOA RR.
+ *
+ * @returns @ref ZONE_SUCCESS on success, @ref ZONE_SEMANTIC_ERROR if the
+ *          zone has no SOA RR or another negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_peek_soa(
+  zone_parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const char *path,
+  zone_soa_t *soa)
+zone_nonnull_all;
+
+/**
+ * @brief Retrieve SOA from string
+ *
+ * Identical to @ref zone_peek_soa, string requirements are identical to
+ * @ref zone_parse_string.
+ *
+ * @param[in]   parser   Zone parser
+ * @param[in]   options  Settings used for parsing.
+ * @param[in]   buffers  Scratch buffers used for parsing.
+ * @param[in]   string   Input string.
+ * @param[in]   length   Length of string (excluding null byte and padding).
+ * @param[out]  soa      Fields of first SOA RR.
+ *
+ * @returns @ref ZONE_SUCCESS on success, @ref ZONE_SEMANTIC_ERROR if the
+ *          zone has no SOA RR or another negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_peek_soa_string(
+  zone_parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const char *string,
+  size_t length,
+  zone_soa_t *soa)
+zone_nonnull_all;
+
+/**
+ * @brief Open zone file
+ *
+ * Open file containing resource records to retrieve RRs one at a time
+ * using @ref zone_next. The parser must be closed with @ref zone_close,
+ * even if opening the file fails.
+ *
+ * @param[in]  parser     Zone parser
+ * @param[in]  options    Settings used for parsing.
+ * @param[in]  buffers    Scratch buffers used for parsing.
+ * @param[in]  path       Path of master file to parse.
+ * @param[in]  user_data  Pointer passed verbatim to callbacks.
+ *
+ * @returns @ref ZONE_SUCCESS on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_open(
+  zone_parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const char *path,
+  void *user_data)
+zone_nonnull((1,2,3,4));
+
+/**
+ * @brief Retrieve next RR
+ *
+ * Parse input up to and including the next RR. Owner and RDATA reside in
+ * the scratch buffers passed to the parser and remain valid until the next
+ * invocation. Callbacks other than the accept callback (log, include,
+ * checkpoint) are invoked as usual. RRs cannot be retrieved if partition,
+ * batch or RRset delivery is configured.
+ *
+ * @param[in]   parser  Zone parser opened with @ref zone_open.
+ * @param[out]  rr      Next RR.
+ *
+ * @returns 1 if an RR was retrieved, 0 at end of input, or a negative
+ *          number on error.
+ */
+ZONE_EXPORT int32_t
+zone_next(
+  zone_parser_t *parser,
+  zone_rr_t *rr)
+zone_nonnull_all;
+
+/**
+ * @brief Parse next slice of zone
+ *
+ * Parse input until the budget is exhausted, then return so that parsing
+ * can be spread over a number of calls, e.g. between events in an event
+ * loop. RRs are delivered as configured, RRs accepted in batch or RRset
+ * delivery mode are flushed at the end of input. Callers that work with a
+ * deadline pick a budget that fits and check the time between steps. The
+ * parser must be closed with @ref zone_close.
+ *
+ * @note RRs that are skipped, e.g. RRs filtered by type or owner, count
+ *       towards the budget so that steps remain bounded.
+ *
+ * @param[in]  parser   Zone parser opened with @ref zone_open.
+ * @param[in]  records  Maximum number of RRs to parse.
+ *
+ * @returns @ref ZONE_AGAIN if the budget was exhausted, @ref ZONE_SUCCESS
+ *          at end of input, or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_parse_step(
+  zone_parser_t *parser,
+  size_t records)
+zone_nonnull_all;
+
+/**
+ * @brief Retrieve hash of current owner
+ *
+ * Case-insensitive CRC32C (Castagnoli) of the owner in wire format, with
+ * ASCII letters folded to lowercase. Kernels with hardware support produce
+ * the exact same value. Valid for the duration of the accept callback if
+ * hash_owners or partition is set.
+ *
+ * @param[in]  parser  Zone parser
+ *
+ * @returns Hash of owner of current RR.
+ */
+ZONE_EXPORT uint32_t
+zone_owner_hash(
+  const zone_parser_t *parser)
+zone_nonnull_all;
+
+/**
+ * @brief Retrieve label offsets of current owner
+ *
+ * Valid for the duration of the accept callback, or until the next
+ * invocation of @ref zone_next, if owner_labels is set.
+ *
+ * @param[in]  parser  Zone parser
+ *
+ * @returns Labels of owner of current RR.
+ */
+ZONE_EXPORT const zone_labels_t *
+zone_owner_labels(
+  const zone_parser_t *parser)
+zone_nonnull_all;
+
+/**
+ * @brief Decode RDATA
+ *
+ * Decode RDATA of the RR passed to the lazy accept callback. Syntax errors
+ * are reported as usual, parsing continues after the callback regardless.
+ * RRs that span buffer boundaries are decoded before the callback is
+ * invoked, in which case decoding errors end parsing.
+ *
+ * @param[in]   rdata   Handle passed to lazy accept callback.
+ * @param[out]  buffer  Buffer to write RDATA section to.
+ *
+ * @returns Length of RDATA section on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_decode_rdata(
+  zone_lazy_rdata_t *rdata,
+  zone_rdata_buffer_t *buffer)
+zone_nonnull_all;
+
+/**
+ * @brief Close zone file
+ *
+ * Close every file opened by the parser.
+ *
+ * @param[in]  parser  Zone parser
+ */
+ZONE_EXPORT void
+zone_close(
+  zone_parser_t *parser)
+zone_nonnull_all;
+
+/**
+ * @brief Create reusable parser
+ *
+ * Allocate a parser that is reused across zones. The kernel is selected
+ * once, the window and tapes are allocated on first use and retained, the
+ * parser is prepared for each zone with @ref zone_parser_reset. Parsers created this
+ * way must only be used with the zone_parser_* functions and must be
+ * released with @ref zone_parser_destroy.
+ * The parser itself is allocated with calloc, window and tapes are
+ * allocated by the allocator in the options passed on reset.
+ *
+ * @returns Parser on success or NULL if out of memory.
+ */
+ZONE_EXPORT zone_parser_t *
+zone_parser_create(void);
+
+/**
+ * @brief Prepare reusable parser for next zone
+ *
+ * Reinitialize parser state for the next zone. The window, tapes and kernel
+ * are retained.
+ *
+ * @param[in]  parser     Parser created with @ref zone_parser_create.
+ * @param[in]  options    Settings used for parsing.
+ * @param[in]  buffers    Scratch buffers used for parsing.
+ * @param[in]  user_data  Pointer passed verbatim to callbacks.
+ *
+ * @returns @ref ZONE_SUCCESS on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_parser_reset(
+  zone_parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  void *user_data)
+zone_nonnull((1,2,3));
+
+/**
+ * @brief Parse zone file with reusable parser
+ *
+ * The parser must be reset before every zone.
+ *
+ * @param[in]  parser  Parser prepared with @ref zone_parser_reset.
+ * @param[in]  path    Path of master file to parse.
+ *
+ * @returns @ref ZONE_SUCCESS on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_parser_parse(
+  zone_parser_t *parser,
+  const char *path)
+zone_nonnull_all;
+
+/**
+ * @brief Parse zone from string with reusable parser
+ *
+ * The parser must be reset before every zone. String requirements are
+ * identical to @ref zone_parse_string.
+ *
+ * @param[in]  parser  Parser prepared with @ref zone_parser_reset.
+ * @param[in]  string  Input string.
+ * @param[in]  length  Length of string (excluding null byte and padding).
+ *
+ * @returns @ref ZONE_SUCCESS on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_parser_parse_string(
+  zone_parser_t *parser,
+  const char *string,
+  size_t length)
+zone_nonnull_all;
+
+/**
+ * @brief Parse single RR with reusable parser
+ *
+ * Parse exactly one RR, e.g. for dynamic updates. The parser must be reset
+ * once, RRs may then be parsed repeatedly without initializing the parser
+ * again. The input is copied and need not be null terminated or padded.
+ * $INCLUDE entries are not allowed. Owner and RDATA reside in the scratch
+ * buffers passed on reset and remain valid until the next invocation.
+ *
+ * @param[in]   parser       Parser prepared with @ref zone_parser_reset.
+ * @param[in]   string       Input string.
+ * @param[in]   length       Length of string.
+ * @param[in]   origin       Origin (in wire format), NULL for configured origin.
+ * @param[in]   default_ttl  TTL for RR without TTL.
+ * @param[out]  rr           Resource record.
+ *
+ * @returns @ref ZONE_SUCCESS on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_parse_rr(
+  zone_parser_t *parser,
+  const char *string,
+  size_t length,
+  const zone_name_t *origin,
+  uint32_t default_ttl,
+  zone_rr_t *rr)
+zone_nonnull((1,2,6));
+
+/**
+ * @brief Destroy reusable parser
+ *
+ * @param[in]  parser  Parser created with @ref zone_parser_create.
+ */
+ZONE_EXPORT void
+zone_parser_destroy(
+  zone_parser_t *parser);
+
+/**
+ * @brief Resume parsing from checkpoint
+ *
+ * Reopen every file in the include stack of the checkpoint, restore the
+ * parser state and continue parsing from the recorded offsets. The include
+ * callback is not invoked for files in the checkpoint.
+ *
+ * @param[in]  parser      Zone parser
+ * @param[in]  options     Settings used for parsing.
+ * @param[in]  buffers     Scratch buffers used for parsing.
+ * @param[in]  checkpoint  Checkpoint to resume from.
+ * @param[in]  user_data   Pointer passed verbatim to callbacks.
+ *
+ * @returns @ref ZONE_SUCCESS on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_resume(
+  zone_parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const zone_checkpoint_t *checkpoint,
+  void *user_data)
+zone_nonnull((1,2,3,4));
+
+/**
+ * @brief Collection of RRs to put in canonical order.
+ *
+ * RRs are copied into a single buffer and sorted by offset. The ordering is
+ * that of RFC 4034 section 6, RRs are ordered by owner, class, type and
+ * RDATA. Domain names in RDATA are compared as is.
+ *
+ * If memory is limited, sorted runs are spilled to temporary files once the
+ * limit is reached and merged again by @ref zone_sorter_drain.
+ *
+ * @warning Do not modify directly.
+ */
+typedef struct zone_sorter zone_sorter_t;
+struct zone_sorter {
+  /** @private */
+  size_t count, capacity;
+  /** @private */
+  size_t *records, *scratch;
+  /** @private */
+  struct {
+    size_t length, capacity;
+    uint8_t *octets;
+  } data;
+  /** @private */
+  size_t limit;
+  /** @private */
+  bool sorted;
+  /** @private */
+  struct {
+    size_t count;
+    FILE **files;
+  } runs;
+};
+
+/**
+ * @brief Signature of callback function invoked for each sorted RR.
+ */
+typedef int32_t(*zone_sorted_t)(
+  const zone_rr_t *, // rr
+  void *); // user data
+
+/**
+ * @brief Initialize sorter.
+ *
+ * @param[in]  sorter  Sorter.
+ */
+ZONE_EXPORT void
+zone_sorter_init(
+  zone_sorter_t *sorter)
+zone_nonnull_all;
+
+/**
+ * @brief Limit memory used for RRs in sorter.
+ *
+ * Half of the memory is used for RRs, the other half for offsets. Sorted
+ * runs are written to temporary files if either is exhausted. Merging runs
+ * requires a buffer of 64KB for every run in addition.
+ *
+ * @param[in]  sorter  Sorter, must not contain RRs.
+ * @param[in]  memory  Maximum number of bytes to use.
+ *
+ * @returns @ref ZONE_SUCCESS on success or @ref ZONE_BAD_PARAMETER if the
+ *          sorter contains RRs or the limit cannot hold the largest
+ *          possible RR.
+ */
+ZONE_EXPORT int32_t
+zone_sorter_limit(
+  zone_sorter_t *sorter,
+  size_t memory)
+zone_nonnull_all;
+
+/**
+ * @brief Release memory held by sorter.
+ *
+ * @param[in]  sorter  Sorter.
+ */
+ZONE_EXPORT void
+zone_sorter_destroy(
+  zone_sorter_t *sorter)
+zone_nonnull_all;
+
+/**
+ * @brief Add RR to sorter.
+ *
+ * Arguments match those of @ref zone_accept_t, the accept callback can
+ * forward RRs verbatim.
+ *
+ * @returns @ref ZONE_SUCCESS on success, @ref ZONE_OUT_OF_MEMORY if memory
+ *          could not be allocated or @ref ZONE_WRITE_ERROR if a run could
+ *          not be written to a temporary file.
+ */
+ZONE_EXPORT int32_t
+zone_sorter_add(
+  zone_sorter_t *sorter,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata)
+zone_nonnull((1,2));
+
+/**
+ * @brief Sort slice of RRs.
+ *
+ * RRs are divided into a number of slices of (roughly) equal size. Distinct
+ * slices may be sorted concurrently from different threads. Slices must be
+ * merged with @ref zone_sorter_merge once every slice is sorted.
+ *
+ * @param[in]  sorter  Sorter.
+ * @param[in]  slice   Slice to sort.
+ * @param[in]  slices  Number of slices.
+ */
+ZONE_EXPORT void
+zone_sorter_sort_slice(
+  zone_sorter_t *sorter,
+  size_t slice,
+  size_t slices)
+zone_nonnull_all;
+
+/**
+ * @brief Merge sorted slices of RRs.
+ *
+ * @param[in]  sorter  Sorter.
+ * @param[in]  slices  Number of slices passed to @ref zone_sorter_sort_slice.
+ */
+ZONE_EXPORT void
+zone_sorter_merge(
+  zone_sorter_t *sorter,
+  size_t slices)
+zone_nonnull_all;
+
+/**
+ * @brief Sort RRs.
+ *
+ * Shorthand to sort all RRs as a single slice.
+ *
+ * @param[in]  sorter  Sorter.
+ */
+ZONE_EXPORT void
+zone_sorter_sort(
+  zone_sorter_t *sorter)
+zone_nonnull_all;
+
+/**
+ * @brief Number of RRs in sorter.
+ */
+ZONE_EXPORT size_t
+zone_sorter_size(
+  const zone_sorter_t *sorter)
+zone_nonnull_all;
+
+/**
+ * @brief Retrieve RR at index.
+ *
+ * RRs are returned in canonical order once sorted. Pointers remain valid
+ * until RRs are added or the sorter is destroyed. Only RRs that are held
+ * in memory are available, use @ref zone_sorter_drain if memory is limited.
+ *
+ * @param[in]   sorter  Sorter.
+ * @param[in]   index   Index of RR, must be less than @ref zone_sorter_size.
+ * @param[out]  rr      RR.
+ */
+ZONE_EXPORT void
+zone_sorter_get(
+  const zone_sorter_t *sorter,
+  size_t index,
+  zone_rr_t *rr)
+zone_nonnull_all;
+
+/**
+ * @brief Pass sorted, deduplicated, RRs to callback.
+ *
+ * Sort RRs held in memory, unless sorted already, and merge them with runs
+ * spilled to temporary files. RRs that compare equal, i.e. that differ in
+ * TTL only, are passed once. The sorter is empty afterwards.
+ *
+ * @param[in]  sorter     Sorter.
+ * @param[in]  callback   Callback invoked for each RR.
+ * @param[in]  user_data  Pointer passed verbatim to callback.
+ *
+ * @returns @ref ZONE_SUCCESS on success or a negative number on error.
+ */
+ZONE_EXPORT int32_t
+zone_sorter_drain(
+  zone_sorter_t *sorter,
+  zone_sorted_t callback,
+  void *user_data)
+zone_nonnull((1,2));
+
 /**
  * @defgroup log_priorities Log categories.
  *
@@ -624,6 +1758,24 @@ ZONE_EXPORT void zone_log(
 zone_nonnull((1,3))
 zone_format_printf(3,4);
 
+/**
+ * @brief Format message of diagnostic.
+ *
+ * Must be invoked from the structured diagnostic callback.
+ *
+ * @param[in]   diagnostic  Diagnostic passed to callback.
+ * @param[out]  buffer      Buffer to write message to.
+ * @param[in]   size        Size of buffer.
+ *
+ * @returns Length of message, like snprintf.
+ */
+ZONE_EXPORT int
+zone_format_diagnostic(
+  const zone_diagnostic_t *diagnostic,
+  char *buffer,
+  size_t size)
+zone_nonnull_all;
+
 /**
  * @brief Write error message to active log handler.
  * @hideinitializer
@@ -651,7 +1803,7 @@ zone_format_printf(3,4);
  * @param[in]  ...     Variadic arguments corresponding to @format.
  */
 #define zone_warning(parser, ...) \
-  (((parser)->options.mask & ZONE_WARNING) ? \
+  (((parser)->options.log.mask & ZONE_WARNING) ? \
      (void)0 : zone_log((parser), ZONE_WARNING, __VA_ARGS__))
 
 /**
@@ -666,7 +1818,7 @@ zone_format_printf(3,4);
  * @param[in]  ...     Variadic arguments corresponding to @format.
  */
 #define zone_info(parser, ...) \
-  (((parser)->options.mask & ZONE_INFO) ? \
+  (((parser)->options.log.mask & ZONE_INFO) ? \
      (void)0 : zone_log((parser), ZONE_INFO, __VA_ARGS__))
 
 #if defined(__cplusplus)
@@ -34,15 +34,18 @@ typedef zone_parser_t parser_t;
 #if HAVE_HASWELL
 extern int32_t zone_bench_haswell_lex(zone_parser_t *, size_t *);
 extern int32_t zone_haswell_parse(zone_parser_t *);
+extern int32_t zone_bench_haswell_parse(zone_parser_t *);
 #endif
 
 #if HAVE_WESTMERE
 extern int32_t zone_bench_westmere_lex(zone_parser_t *, size_t *);
 extern int32_t zone_westmere_parse(zone_parser_t *);
+extern int32_t zone_bench_westmere_parse(zone_parser_t *);
 #endif
 
 extern int32_t zone_bench_fallback_lex(zone_parser_t *, size_t *);
 extern int32_t zone_fallback_parse(zone_parser_t *);
+extern int32_t zone_bench_fallback_parse(zone_parser_t *);
 
 typedef struct kernel kernel_t;
 struct kernel {
@@ -50,28 +53,23 @@ struct kernel {
   uint32_t instruction_set;
   int32_t (*bench_lex)(zone_parser_t *, size_t *);
   int32_t (*parse)(zone_parser_t *);
+  // kernel compiled in template mode, accept function is inlined
+  int32_t (*bench_parse)(zone_parser_t *);
 };
 
 static const kernel_t kernels[] = {
 #if HAVE_HASWELL
-  { "haswell", AVX2, &zone_bench_haswell_lex, &zone_haswell_parse },
+  { "haswell", AVX2, &zone_bench_haswell_lex, &zone_haswell_parse,
+    &zone_bench_haswell_parse },
 #endif
 #if HAVE_WESTMERE
-  { "westmere", SSE42|PCLMULQDQ, &zone_bench_westmere_lex, &zone_westmere_parse },
+  { "westmere", SSE42|PCLMULQDQ, &zone_bench_westmere_lex, &zone_westmere_parse,
+    &zone_bench_westmere_parse },
 #endif
-  { "fallback", DEFAULT, &zone_bench_fallback_lex, &zone_fallback_parse }
+  { "fallback", DEFAULT, &zone_bench_fallback_lex, &zone_fallback_parse,
+    &zone_bench_fallback_parse }
 };
 
-extern int32_t zone_open(
-  zone_parser_t *,
-  const zone_options_t *,
-  zone_buffers_t *,
-  const char *,
-  void *user_data);
-
-extern void zone_close(
-  zone_parser_t *);
-
 static int32_t bench_lex(zone_parser_t *parser, const kernel_t *kernel)
 {
   size_t tokens = 0;
@@ -117,6 +115,18 @@ static int32_t bench_parse(zone_parser_t *parser, const kernel_t *kernel)
   return result;
 }
 
+static int32_t bench_template(zone_parser_t *parser, const kernel_t *kernel)
+{
+  size_t records = 0;
+  int32_t result;
+
+  parser->user_data = &records;
+  result = kernel->bench_parse(parser);
+
+  printf("Parsed %zu records\n", records);
+  return result;
+}
+
 diagnostic_push()
 msvc_diagnostic_ignored(4996)
 
@@ -153,7 +163,7 @@ diagnostic_pop()
 static void help(const char *program)
 {
   const char *format =
-    "Usage: %s [OPTION] <lex or parse> <zone file>\n"
+    "Usage: %s [OPTION] <lex, parse or template> <zone file>\n"
     "\n"
     "Options:\n"
     "  -h         Display available options.\n"
@@ -169,7 +179,7 @@ static void help(const char *program)
 
 static void usage(const char *program)
 {
-  fprintf(stderr, "Usage: %s [OPTION] <lex or parse> <zone file>\n", program);
+  fprintf(stderr, "Usage: %s [OPTION] <lex, parse or template> <zone file>\n", program);
   exit(EXIT_FAILURE);
 }
 
@@ -204,6 +214,8 @@ int main(int argc, char *argv[])
     bench = &bench_lex;
   else if (strcasecmp(argv[optind], "parse") == 0)
     bench = &bench_parse;
+  else if (strcasecmp(argv[optind], "template") == 0)
+    bench = &bench_template;
   else
     usage(program);
 
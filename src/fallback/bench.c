@@ -8,9 +8,33 @@
  */
 #include "zone.h"
 #include "attributes.h"
-#include "diagnostic.h"
-#include "generic/parser.h"
-#include "fallback/scanner.h"
+
+// accept function equivalent to the callback in bench.c, compiled into the
+// kernel in template mode to measure the cost of the indirect call
+static really_inline int32_t bench_inline_accept(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  (void)parser;
+  (void)owner;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  (*(size_t *)user_data)++;
+  return ZONE_SUCCESS;
+}
+
+#define ZONE_ACCEPT bench_inline_accept
+#define ZONE_PARSE zone_bench_fallback_parse
+#include "fallback/parser.c"
 
 diagnostic_push()
 clang_diagnostic_ignored(missing-prototypes)
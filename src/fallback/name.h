@@ -55,4 +55,12 @@ static really_inline int32_t scan_name(
   return *l != 0;
 }
 
+// canonical form (RFC 4034 section 6.2)
+nonnull_all
+static really_inline void lower_name(uint8_t *octets, size_t length)
+{
+  for (size_t i=0; i < length; i++)
+    octets[i] = fold_octet(octets[i]);
+}
+
 #endif // NAME_H
@@ -9,6 +9,7 @@
 #include "zone.h"
 #include "attributes.h"
 #include "diagnostic.h"
+#include "generic/fold.h"
 #include "generic/endian.h"
 #include "fallback/bits.h"
 #include "generic/parser.h"
@@ -37,16 +38,39 @@
 #include "generic/cert.h"
 #include "generic/atma.h"
 #include "generic/algorithm.h"
+#include "generic/hash.h"
+#include "generic/subtree.h"
+#include "generic/labels.h"
 #include "generic/types.h"
 #include "generic/type.h"
 #include "generic/format.h"
+#if !defined ZONE_ACCEPT
+#include "generic/estimate.h"
+#endif
 
 diagnostic_push()
 clang_diagnostic_ignored(missing-prototypes)
 
+#if defined ZONE_ACCEPT
+// template mode, see zone_kernel_t
+#if !defined ZONE_PARSE
+# error "ZONE_PARSE must be defined in template mode"
+#endif
+
+int32_t ZONE_PARSE(parser_t *parser)
+{
+  return parse(parser);
+}
+#else
 int32_t zone_fallback_parse(parser_t *parser)
 {
   return parse(parser);
 }
 
+int32_t zone_fallback_estimate(parser_t *parser, zone_estimate_t *estimate)
+{
+  return estimate_zone(parser, estimate);
+}
+#endif
+
 diagnostic_pop()
@@ -165,7 +165,7 @@ static really_inline int32_t parse_algorithm(
   const token_t *token)
 {
   if (!scan_algorithm(token->data, token->length, rdata->octets))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   rdata->octets++;
   return 0;
 }
@@ -96,7 +96,7 @@ static really_inline int32_t parse_atma_e164(
     bad_chars |= bad_atma_chars[octet];
   }
   if (bad_chars)
-    SEMANTIC_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SEMANTIC_ERROR_IN(parser, field, type);
 
   return 0;
 }
@@ -199,15 +199,15 @@ static really_inline int32_t parse_atma(
   if (token->length && (char)*token->data == '+') {
     *rdata->octets++ = 1;
     if ((uintptr_t)rdata->limit - (uintptr_t)rdata->octets < token->length)
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+      SYNTAX_ERROR_IN(parser, field, type);
     return parse_atma_e164(parser, type, field, rdata, token);
   }
   size_t length = token->length / 2;
   if ((uintptr_t)rdata->limit - (uintptr_t)rdata->octets < length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   *rdata->octets++ = 0;
   if (!atma_decode(token->data, token->length, rdata->octets, &length))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   rdata->octets += length;
   return 0;
 }
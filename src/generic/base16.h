@@ -182,6 +182,9 @@ static really_inline int base16_stream_decode(
 #endif
     {
     case 0:
+#if defined(base16_dec_loop_simd)
+      base16_dec_loop_simd(&s, &slen, &o, &olen);
+#endif
       base16_dec_loop_generic_32(&s, &slen, &o, &olen);
       if (slen-- == 0) {
         ret = 1;
@@ -247,9 +250,9 @@ static really_inline int32_t parse_base16_sequence(
     do {
       size_t length = (token->length + 1) / 2;
       if ((uintptr_t)rdata->limit - (uintptr_t)rdata->octets < length)
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+        SYNTAX_ERROR_IN(parser, field, type);
       if (!base16_stream_decode(&state, token->data, token->length, rdata->octets, &length))
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+        SYNTAX_ERROR_IN(parser, field, type);
       rdata->octets += length;
       take(parser, token);
     } while (is_contiguous(token));
@@ -271,9 +274,9 @@ static really_inline int32_t parse_base16(
 {
   size_t length = token->length / 2;
   if ((uintptr_t)rdata->limit - (uintptr_t)rdata->octets < length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   if (!base16_decode(token->data, token->length, rdata->octets, &length))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   rdata->octets += length;
   return 0;
 }
@@ -293,9 +296,9 @@ static really_inline int32_t parse_salt(
   uint8_t *octets = rdata->octets++;
   // FIXME: not quite right yet! we must not exceed 255 octets!
   if ((uintptr_t)rdata->limit - (uintptr_t)rdata->octets < (length + 1))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   if (!base16_decode(token->data, token->length, rdata->octets, &length))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   *octets = (uint8_t)length;
   rdata->octets += length;
   return 0;
@@ -58,7 +58,7 @@ static really_inline int32_t parse_base32(
 
   size_t length = (token->length * 5) / 8;
   if (length > 255 || (uintptr_t)rdata->limit - (uintptr_t)rdata->octets < (length + 1))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
 
   *rdata->octets++ = (uint8_t)length;
 
@@ -110,7 +110,7 @@ static really_inline int32_t parse_base32(
   }
 
   if (p != token->data + token->length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   return 0;
 }
 
@@ -703,16 +703,16 @@ static really_inline int32_t parse_base64_sequence(
     do {
       size_t length = token->length / 4;
       if (((uintptr_t)rdata->limit - (uintptr_t)rdata->octets) / 3 < length)
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(item), NAME(type));
+        SYNTAX_ERROR_IN(parser, item, type);
       if (!base64_stream_decode(&state, token->data, token->length, rdata->octets, &length))
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(item), NAME(type));
+        SYNTAX_ERROR_IN(parser, item, type);
       rdata->octets += length;
       take(parser, token);
     } while (is_contiguous(token));
 
     // incomplete base64 sequence
     if (state.bytes)
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(item), NAME(type));
+      SYNTAX_ERROR_IN(parser, item, type);
   }
 
   return have_delimiter(parser, type, token);
@@ -728,9 +728,9 @@ static really_inline int32_t parse_base64(
 {
   size_t length = token->length / 4;
   if (((uintptr_t)rdata->limit - (uintptr_t)rdata->octets) / 3 < length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(item), NAME(type));
+    SYNTAX_ERROR_IN(parser, item, type);
   if (!base64_decode(token->data, token->length, rdata->octets, &length))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(item), NAME(type));
+    SYNTAX_ERROR_IN(parser, item, type);
   rdata->octets += length;
   return 0;
 }
@@ -59,7 +59,7 @@ static really_inline int32_t parse_caa_tag(
   // https://www.iana.org/assignments/pkix-parameters/pkix-parameters.xhtml
 
   if (token->length > 255)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   *rdata->octets++ = (uint8_t)token->length;
 
   uint32_t bad_chars = 0;
@@ -73,7 +73,7 @@ static really_inline int32_t parse_caa_tag(
   // and the numbers 0 through 9. Tags MUST NOT contain any other
   // characters. Matching of tags is case insensitive.
   if (bad_chars)
-    SEMANTIC_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SEMANTIC_ERROR_IN(parser, field, type);
 
   return 0;
 }
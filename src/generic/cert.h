@@ -113,7 +113,7 @@ static really_inline int32_t parse_certificate_type(
 {
   uint16_t cert;
   if (!scan_certificate_type(token->data, token->length, &cert))
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+      SYNTAX_ERROR_IN(parser, field, type);
   cert = htobe16(cert);
   memcpy(rdata->octets, &cert, 2);
   rdata->octets += 2;
@@ -0,0 +1,61 @@
+/*
+ * estimate.h -- estimate size of zone without parsing RRs
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef ESTIMATE_H
+#define ESTIMATE_H
+
+nonnull_all
+static really_inline bool is_signature(const token_t *token)
+{
+  static const char rrsig[5] = { 'r', 'r', 's', 'i', 'g' };
+
+  if (token->code != CONTIGUOUS || token->length != 5)
+    return false;
+  for (size_t i=0; i < 5; i++)
+    if ((token->data[i] | 0x20) != rrsig[i])
+      return false;
+  return true;
+}
+
+// only the scanner runs, tokens are counted per line and never decoded.
+// the first token on a line is taken to start an RR, unless it is a
+// directive, which makes the counts approximate for invalid input
+nonnull_all
+static int32_t estimate_zone(parser_t *parser, zone_estimate_t *estimate)
+{
+  token_t token;
+  bool first = true;
+
+  for (take(parser, &token); token.code > 0; take(parser, &token)) {
+    // line feeds in grouped entries are not returned
+    if (token.code == LINE_FEED) {
+      first = true;
+      continue;
+    }
+
+    estimate->fields++;
+    estimate->signatures += is_signature(&token);
+    if (!first)
+      continue;
+    first = false;
+    if (!parser->file->start_of_line) {
+      estimate->records++;
+      estimate->blank_owners++;
+    } else if (token.code != CONTIGUOUS || token.data[0] != '$') {
+      estimate->records++;
+      estimate->owners++;
+    }
+  }
+
+  estimate->lines = parser->file->span;
+  estimate->octets =
+    parser->file->buffer.offset + parser->file->buffer.length;
+  return token.code;
+}
+
+#endif // ESTIMATE_H
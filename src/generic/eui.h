@@ -42,7 +42,7 @@ static really_inline int32_t parse_eui48(
       eui_base16_dec_loop_generic_32_inner(input+6, rdata->octets+2, false) &&
       eui_base16_dec_loop_generic_32_inner(input+12, rdata->octets+4, true))
     return (void)(rdata->octets += 6), 0;
-  SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+  SYNTAX_ERROR_IN(parser, field, type);
 }
 
 // RFC7043 section 4.2, require xx-xx-xx-xx-xx-xx-xx-xx
@@ -61,7 +61,7 @@ static really_inline int32_t parse_eui64(
       eui_base16_dec_loop_generic_32_inner(input+12, rdata->octets+4, false) &&
       eui_base16_dec_loop_generic_32_inner(input+18, rdata->octets+6, true))
     return (void)(rdata->octets += 8), 0;
-  SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+  SYNTAX_ERROR_IN(parser, field, type);
 }
 
 #endif // EUI_H
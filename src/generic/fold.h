@@ -0,0 +1,33 @@
+/*
+ * fold.h -- ASCII case folding
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef FOLD_H
+#define FOLD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// fold ASCII letters to lowercase, other octets are left untouched
+static really_inline uint8_t fold_octet(uint8_t octet)
+{
+  return octet | (uint8_t)(((uint8_t)(octet - 'A') < 26) << 5);
+}
+
+// compare octets case-insensitively, e.g. domain names in wire format
+nonnull_all
+static really_inline bool is_same_folded(
+  const uint8_t *octets1, const uint8_t *octets2, size_t length)
+{
+  for (size_t i=0; i < length; i++)
+    if (octets1[i] != octets2[i] && fold_octet(octets1[i]) != fold_octet(octets2[i]))
+      return false;
+  return true;
+}
+
+#endif // FOLD_H
@@ -30,13 +30,32 @@ static really_inline int32_t parse_type(
   const mnemonic_t *mnemonic;
 
   if (scan_type(token->data, token->length, &code, &mnemonic) != 1)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   code = htobe16(code);
   memcpy(rdata->octets, &code, 2);
   rdata->octets += 2;
   return 0;
 }
 
+// types for which names in RDATA are converted to lowercase in canonical
+// form, RFC 4034 section 6.2 as updated by RFC 6840 section 5.1 (NSEC)
+#define CANONICAL_TYPES \
+  ((1llu << ZONE_TYPE_NS) | (1llu << ZONE_TYPE_MD) | (1llu << ZONE_TYPE_MF) | \
+   (1llu << ZONE_TYPE_CNAME) | (1llu << ZONE_TYPE_SOA) | (1llu << ZONE_TYPE_MB) | \
+   (1llu << ZONE_TYPE_MG) | (1llu << ZONE_TYPE_MR) | (1llu << ZONE_TYPE_PTR) | \
+   (1llu << ZONE_TYPE_MINFO) | (1llu << ZONE_TYPE_MX) | (1llu << ZONE_TYPE_RP) | \
+   (1llu << ZONE_TYPE_AFSDB) | (1llu << ZONE_TYPE_RT) | (1llu << ZONE_TYPE_SIG) | \
+   (1llu << ZONE_TYPE_PX) | (1llu << ZONE_TYPE_NXT) | (1llu << ZONE_TYPE_NAPTR) | \
+   (1llu << ZONE_TYPE_KX) | (1llu << ZONE_TYPE_SRV) | (1llu << ZONE_TYPE_DNAME) | \
+   (1llu << ZONE_TYPE_A6) | (1llu << ZONE_TYPE_RRSIG))
+
+nonnull_all
+static really_inline bool is_canonical_type(const type_info_t *type)
+{
+  return type->name.value < 64 &&
+         ((CANONICAL_TYPES >> type->name.value) & 1u);
+}
+
 nonnull_all
 static really_inline int32_t parse_name(
   parser_t *parser,
@@ -54,19 +73,22 @@ static really_inline int32_t parse_name(
     goto relative;
   switch (scan_name(token->data, token->length, rdata->octets, &length)) {
     case 0:
-      rdata->octets += length;
-      return 0;
+      goto canonical;
     case 1:
       goto relative;
   }
 
-  SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+  SYNTAX_ERROR_IN(parser, field, type);
 
 relative:
   if (length > 255 - parser->file->origin.length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   memcpy(rdata->octets + length, parser->file->origin.octets, parser->file->origin.length);
-  rdata->octets += length + parser->file->origin.length;
+  length += parser->file->origin.length;
+canonical:
+  if (unlikely(parser->options.canonical) && is_canonical_type(type))
+    lower_name(rdata->octets, length);
+  rdata->octets += length;
   return 0;
 }
 
@@ -89,19 +111,30 @@ static really_inline int32_t parse_owner(
     case 0:
       parser->file->owner.length = length;
       parser->owner = &parser->file->owner;
-      return 0;
+      goto hash;
     case 1:
       goto relative;
   }
 
-  SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+  SYNTAX_ERROR_IN(parser, field, type);
 
 relative:
   if (length > 255 - parser->file->origin.length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   memcpy(octets+length, parser->file->origin.octets, parser->file->origin.length);
   parser->file->owner.length = length + parser->file->origin.length;
   parser->owner = &parser->file->owner;
+hash:
+  if (unlikely(parser->options.canonical))
+    lower_name(octets, parser->file->owner.length);
+  parser->owner_stated = true;
+  // hash once per stated owner, records with a blank owner reuse the hash
+  if (unlikely(parser->hash_owners))
+    parser->owner_hash = hash_name(octets, parser->file->owner.length);
+  if (unlikely(parser->options.owner_labels))
+    index_labels(&parser->labels, octets, parser->file->owner.length);
+  // records with a blank owner inherit the scope of the last stated owner
+  update_scope(parser, octets, parser->file->owner.length);
   return 0;
 }
 
@@ -114,7 +147,7 @@ static really_inline int32_t parse_string(
   const token_t *token)
 {
   if (rdata->limit == rdata->octets)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(type), NAME(field));
+    SYNTAX_ERROR_IN(parser, field, type);
   assert(rdata->limit > rdata->octets);
 
   int32_t length;
@@ -124,7 +157,7 @@ static really_inline int32_t parse_string(
   if (rdata->limit - rdata->octets > (1 + 255))
     limit = rdata->octets + 1 + 255;
   if ((length = scan_string(token->data, token->length, octets, limit)) == -1)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(type), NAME(field));
+    SYNTAX_ERROR_IN(parser, field, type);
   *rdata->octets = (uint8_t)length;
   rdata->octets += 1u + (uint32_t)length;
   return 0;
@@ -141,11 +174,195 @@ static really_inline int32_t parse_text(
   int32_t length;
 
   if ((length = scan_string(token->data, token->length, rdata->octets, rdata->limit)) == -1)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(type), NAME(field));
+    SYNTAX_ERROR_IN(parser, field, type);
   rdata->octets += (uint32_t)length;
   return 0;
 }
 
+nonnull_all
+warn_unused_result
+static really_inline bool is_filtered(const parser_t *parser, uint16_t type)
+{
+  bool listed = false;
+
+  if (type < 256) {
+    listed = (parser->filter[type >> 6] & (1ull << (type & 63))) != 0;
+  } else {
+    for (size_t i=0; !listed && i < parser->options.filter.count; i++)
+      listed = parser->options.filter.types[i] == type;
+  }
+
+  return listed == parser->options.filter.deny;
+}
+
+// skip to the delimiter without decoding RDATA. quoting and grouping are
+// resolved by the scanner, which is enough to stay in sync with the input
+nonnull_all
+static never_inline int32_t skip_rdata(parser_t *parser, token_t *token)
+{
+  do {
+    take(parser, token);
+    if (token->code < 0)
+      return token->code;
+  } while (!is_delimiter(token));
+
+  adjust_line_count(parser->file);
+  return 0;
+}
+
+nonnull_all
+static really_inline int32_t parse_rdata(
+  parser_t *parser, const type_info_t *type, rdata_t *rdata, token_t *token)
+{
+  // RFC3597
+  // parse generic rdata if rdata starts with "\\#"
+  take(parser, token);
+  if (likely(token->data[0] != '\\'))
+    return type->parse(parser, type, rdata, token);
+  else if (is_contiguous(token) && strncmp(token->data, "\\#", token->length) == 0)
+    return parse_generic_rdata(parser, type, rdata, token);
+  else
+    return type->parse(parser, type, rdata, token);
+}
+
+nonnull_all
+static really_inline void save_tape(
+  const file_t *file, zone_lazy_rdata_t *lazy)
+{
+  lazy->tape.fields = file->fields.head;
+  lazy->tape.delimiters = file->delimiters.head;
+  lazy->tape.newlines = file->newlines.head;
+  lazy->tape.span = file->span;
+  lazy->tape.line = file->line;
+  lazy->tape.grouped = file->grouped;
+  lazy->tape.start_of_line = file->start_of_line;
+}
+
+nonnull_all
+static really_inline void restore_tape(
+  file_t *file, const zone_lazy_rdata_t *lazy)
+{
+  file->fields.head = lazy->tape.fields;
+  file->delimiters.head = lazy->tape.delimiters;
+  file->newlines.head = lazy->tape.newlines;
+  file->span = lazy->tape.span;
+  file->line = lazy->tape.line;
+  file->grouped = lazy->tape.grouped;
+  file->start_of_line = lazy->tape.start_of_line;
+}
+
+// tokens are invalidated once the tape is refilled, RDATA can only be
+// decoded on demand if the remainder of the record is on the tape
+nonnull_all
+warn_unused_result
+static really_inline bool is_record_on_tape(const file_t *file)
+{
+  bool grouped = file->grouped;
+
+  for (const char **field = file->fields.head; ; field++) {
+    switch (classify[ (uint8_t)**field ]) {
+      case LINE_FEED:
+        if (!grouped)
+          return true;
+        break;
+      case LEFT_PAREN:
+        grouped = true;
+        break;
+      case RIGHT_PAREN:
+        grouped = false;
+        break;
+      case END_OF_FILE:
+        return file->end_of_file == NO_MORE_DATA;
+    }
+  }
+}
+
+// decode RDATA with the accept callback replaced by capturing the length
+nonnull_all
+static really_inline int32_t decode_rdata(
+  parser_t *parser, zone_lazy_rdata_t *lazy, rdata_t *rdata, token_t *token)
+{
+  const bool custom_delivery = parser->custom_delivery;
+  int32_t code;
+
+  parser->custom_delivery = true;
+  parser->lazy = lazy;
+  code = parse_rdata(parser, lazy->type, rdata, token);
+  parser->lazy = NULL;
+  parser->custom_delivery = custom_delivery;
+  return code;
+}
+
+nonnull_all
+static int32_t decode_lazy_rdata(
+  zone_lazy_rdata_t *lazy, zone_rdata_buffer_t *buffer)
+{
+  parser_t *parser = lazy->parser;
+  zone_rdata_buffer_t *scratch = parser->rdata;
+  rdata_t rdata = { buffer->octets, buffer->octets + 65535 };
+  token_t token;
+  int32_t code;
+
+  if (lazy->octets) {
+    memcpy(buffer->octets, lazy->octets, lazy->length);
+    return lazy->length;
+  }
+
+  restore_tape(parser->file, lazy);
+  parser->rdata = buffer;
+  code = decode_rdata(parser, lazy, &rdata, &token);
+  parser->rdata = scratch;
+  // rewind so that RDATA can be decoded again or skipped after the callback
+  restore_tape(parser->file, lazy);
+  return code < 0 ? code : lazy->length;
+}
+
+nonnull_all
+static never_inline int32_t accept_lazy_rr(
+  parser_t *parser, const type_info_t *type, token_t *token)
+{
+  zone_lazy_rdata_t lazy;
+  int32_t code;
+
+  lazy.parser = parser;
+  lazy.type = type;
+  lazy.decode = &decode_lazy_rdata;
+  lazy.octets = NULL;
+  lazy.length = 0;
+
+  if (likely(is_record_on_tape(parser->file))) {
+    save_tape(parser->file, &lazy);
+  } else {
+    const size_t line = parser->file->line;
+    rdata_t rdata = { parser->rdata->octets, parser->rdata->octets + 65535 };
+    if ((code = decode_rdata(parser, &lazy, &rdata, token)) < 0)
+      return code;
+    lazy.octets = parser->rdata->octets;
+    // line count is adjusted on accept, report the starting line instead
+    parser->file->span = parser->file->line - line;
+    parser->file->line = line;
+  }
+
+  code = parser->options.lazy.callback(
+    parser,
+    &(zone_name_t){ (uint8_t)parser->owner->length, parser->owner->octets },
+    parser->file->last_type,
+    parser->file->last_class,
+    *parser->file->ttl,
+    &lazy,
+    parser->user_data);
+
+  if (unlikely(code > 0))
+    code = skip_owner(parser, code);
+  if (lazy.octets) {
+    adjust_line_count(parser->file);
+    return code;
+  } else if (code < 0) {
+    return code;
+  }
+  return skip_rdata(parser, token);
+}
+
 nonnull_all
 static really_inline int32_t parse_rr(
   parser_t *parser, token_t *token)
@@ -169,9 +386,9 @@ static really_inline int32_t parse_rr(
   if ((uint8_t)token->data[0] - '0' < 10) {
     parser->file->ttl = &parser->file->last_ttl;
     if (!scan_ttl(token->data, token->length, parser->options.pretty_ttls, &parser->file->last_ttl))
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(&rr));
+      SYNTAX_ERROR_IN(parser, &fields[3], &rr);
     if (parser->file->last_ttl & (1u << 31))
-      SEMANTIC_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(&rr));
+      SEMANTIC_ERROR_IN(parser, &fields[3], &rr);
     goto class_or_type;
   } else {
     switch (scan_type_or_class(token->data, token->length, &parser->file->last_type, &mnemonic)) {
@@ -181,7 +398,7 @@ static really_inline int32_t parse_rr(
         parser->file->last_class = parser->file->last_type;
         goto ttl_or_type;
       default:
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[1]), NAME(&rr));
+        SYNTAX_ERROR_IN(parser, &fields[1], &rr);
     }
   }
 
@@ -191,13 +408,13 @@ ttl_or_type:
   if ((uint8_t)token->data[0] - '0' < 10) {
     parser->file->ttl = &parser->file->last_ttl;
     if (!scan_ttl(token->data, token->length, parser->options.pretty_ttls, &parser->file->last_ttl))
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(&rr));
+      SYNTAX_ERROR_IN(parser, &fields[3], &rr);
     if (parser->file->last_ttl & (1u << 31))
-      SEMANTIC_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(&rr));
+      SEMANTIC_ERROR_IN(parser, &fields[3], &rr);
     goto type;
   } else {
     if (unlikely(scan_type(token->data, token->length, &parser->file->last_type, &mnemonic) != 1))
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[1]), NAME(&rr));
+      SYNTAX_ERROR_IN(parser, &fields[1], &rr);
     goto rdata;
   }
 
@@ -211,27 +428,28 @@ class_or_type:
       parser->file->last_class = parser->file->last_type;
       goto type;
     default:
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[0]), NAME(&rr));
+      SYNTAX_ERROR_IN(parser, &fields[0], &rr);
   }
 
 type:
   if ((code = take_contiguous(parser, &rr, &fields[1], token)) < 0)
     return code;
   if (unlikely(scan_type(token->data, token->length, &parser->file->last_type, &mnemonic) != 1))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[1]), NAME(&rr));
+    SYNTAX_ERROR_IN(parser, &fields[1], &rr);
 
 rdata:
-  descriptor = (const type_info_t *)mnemonic;
+  // TTL, class and type are parsed for out of scope records too as they
+  // may be inherited by records that follow
+  if (unlikely(parser->out_of_scope))
+    return skip_rdata(parser, token);
+  if (unlikely(parser->options.filter.count) &&
+      is_filtered(parser, parser->file->last_type))
+    return skip_rdata(parser, token);
 
-  // RFC3597
-  // parse generic rdata if rdata starts with "\\#"
-  take(parser, token);
-  if (likely(token->data[0] != '\\'))
-    return descriptor->parse(parser, descriptor, &rdata, token);
-  else if (is_contiguous(token) && strncmp(token->data, "\\#", token->length) == 0)
-    return parse_generic_rdata(parser, descriptor, &rdata, token);
-  else
-    return descriptor->parse(parser, descriptor, &rdata, token);
+  descriptor = (const type_info_t *)mnemonic;
+  if (unlikely(parser->options.lazy.callback))
+    return accept_lazy_rr(parser, descriptor, token);
+  return parse_rdata(parser, descriptor, &rdata, token);
 }
 
 // RFC1035 section 5.1
@@ -265,7 +483,7 @@ static really_inline int32_t parse_dollar_include(
   if (is_contiguous(token)) {
     if (scan_name(token->data, token->length, name.octets, &name.length) != 0) {
       zone_close_file(parser, file);
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[1]), NAME(&include));
+      SYNTAX_ERROR_IN(parser, &fields[1], &include);
     }
     origin = &name;
     take(parser, token);
@@ -288,6 +506,17 @@ static really_inline int32_t parse_dollar_include(
     return have_delimiter(parser, &include, token);
   }
 
+  // record where to resume the includer for checkpoints, the offset is
+  // unknown if the line feed carries a count of embedded line feeds
+  if (is_end_of_file(token))
+    includer->checkpoint.resume =
+      includer->buffer.offset + includer->buffer.length;
+  else if (token->data != line_feed)
+    includer->checkpoint.resume = includer->buffer.offset +
+      (uint64_t)((token->data + 1) - includer->buffer.data);
+  else
+    includer->checkpoint.resume = UINT64_MAX;
+
   // check for recursive includes
   for (uint32_t depth = 1; includer; depth++, includer = includer->includer) {
     if (strcmp(includer->path, file->path) == 0) {
@@ -313,7 +542,17 @@ static really_inline int32_t parse_dollar_include(
   }
 
   adjust_line_count(parser->file);
-  parser->file = file;
+  // start of next line is unknown if the line feed carries a count of
+  // embedded line feeds
+  const char *next = NULL;
+  if (is_end_of_file(token))
+    next = parser->file->buffer.data + parser->file->buffer.length;
+  else if (token->data != line_feed)
+    next = token->data + 1;
+  if ((code = zone_include_file(parser, file, next)) < 0) {
+    zone_close_file(parser, file);
+    return code;
+  }
   return 0;
 }
 
@@ -330,7 +569,7 @@ static inline int32_t parse_dollar_origin(
   if ((code = take_contiguous_or_quoted(parser, &origin, &fields[0], token)) < 0)
     return code;
   if (scan_name(token->data, token->length, parser->file->origin.octets, &parser->file->origin.length) != 0)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[0]), NAME(&origin));
+    SYNTAX_ERROR_IN(parser, &fields[0], &origin);
   if ((code = take_delimiter(parser, &origin, token)) < 0)
     return code;
 
@@ -351,9 +590,9 @@ static really_inline int32_t parse_dollar_ttl(
   if ((code = take_contiguous(parser, &ttl, &fields[0], token)) < 0)
     return code;
   if (!scan_ttl(token->data, token->length, parser->options.pretty_ttls, &parser->file->dollar_ttl))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[0]), NAME(&ttl));
+    SYNTAX_ERROR_IN(parser, &fields[0], &ttl);
   if (parser->file->dollar_ttl & (1u << 31))
-    SEMANTIC_ERROR(parser, "Invalid %s in %s", NAME(&fields[0]), NAME(&ttl));
+    SEMANTIC_ERROR_IN(parser, &fields[0], &ttl);
   if ((code = take_delimiter(parser, &ttl, token)) < 0)
     return code;
 
@@ -362,6 +601,23 @@ static really_inline int32_t parse_dollar_ttl(
   return 0;
 }
 
+// checkpoints are taken at the start of a line following a record
+nonnull_all
+static never_inline int32_t maybe_checkpoint(
+  parser_t *parser, const token_t *token)
+{
+  // offset is unknown if the line feed carries a count of embedded line feeds
+  if (!is_line_feed(token) || token->data == line_feed)
+    return 0;
+
+  const uint64_t offset = parser->file->buffer.offset +
+    (uint64_t)((token->data + 1) - parser->file->buffer.data);
+  if (offset - parser->file->checkpoint.last < parser->options.checkpoint.interval)
+    return 0;
+  parser->file->checkpoint.last = offset;
+  return zone_checkpoint(parser, offset);
+}
+
 static inline int32_t parse(parser_t *parser)
 {
   static const rdata_info_t fields[] = { FIELD("OWNER") };
@@ -396,6 +652,24 @@ static inline int32_t parse(parser_t *parser)
       }
 
       code = parse_rr(parser, &token);
+      // zone_parse_step sets a budget that covers every RR parsed, including
+      // RRs that are skipped. the budget is not spent entirely so that the
+      // parse loop yields, it is reset by zone_parse_step
+      if (unlikely(parser->budget) && code >= 0) {
+        if (parser->budget == 1)
+          code = ZONE_AGAIN;
+        else
+          parser->budget--;
+      }
+      if (unlikely(parser->options.checkpoint.interval) && code >= 0) {
+        const int32_t yield = code;
+        if ((code = maybe_checkpoint(parser, &token)) == 0)
+          code = yield;
+      }
+      // RR was retrieved by zone_next or budget of zone_parse_step was
+      // spent. positive codes do not stop the parse loop otherwise
+      if (unlikely(code > 0) && (parser->rr || parser->budget))
+        return code;
     } else if (is_end_of_file(&token)) {
       if (parser->file->end_of_file == NO_MORE_DATA) {
         if (!parser->file->includer)
@@ -403,6 +677,14 @@ static inline int32_t parse(parser_t *parser)
         file_t *file = parser->file;
         parser->file = parser->file->includer;
         parser->owner = &parser->file->owner;
+        parser->owner_stated = true;
+        if (parser->hash_owners)
+          parser->owner_hash =
+            hash_name(parser->owner->octets, parser->owner->length);
+        if (parser->options.owner_labels)
+          index_labels(
+            &parser->labels, parser->owner->octets, parser->owner->length);
+        update_scope(parser, parser->owner->octets, parser->owner->length);
         zone_close_file(parser, file);
       }
     } else if (is_line_feed(&token)) {
@@ -70,7 +70,7 @@ static really_inline int32_t parse_latitude(
   rdata->octets += 1 + token->length;
   return 0;
 bad_latitude:
-  SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+  SYNTAX_ERROR_IN(parser, field, type);
 }
 
 nonnull_all
@@ -161,7 +161,7 @@ static really_inline int32_t parse_longitude(
   rdata->octets += 1 + token->length;
   return 0;
 bad_longitude:
-  SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+  SYNTAX_ERROR_IN(parser, field, type);
 }
 
 nonnull_all
@@ -175,7 +175,7 @@ static really_inline int32_t parse_altitude(
   const char *text = token->data;
 
   if (token->length > 255)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
 
   for (; (uint8_t)((uint8_t)*text - '0') <= 9u; text++) ;
 
@@ -183,7 +183,7 @@ static really_inline int32_t parse_altitude(
     for (text++; (uint8_t)((uint8_t)*text - '0') <= 9u; text++) ;
 
   if (text != token->data + token->length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
 
   *rdata->octets = (uint8_t)token->length;
   memcpy(rdata->octets + 1, token->data, token->length);
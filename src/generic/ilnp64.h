@@ -45,7 +45,7 @@ static really_inline int32_t parse_ilnp64(
   }
 
   if (n != 3 || p == g || p - g > 4 || classify[(uint8_t)*p] == CONTIGUOUS)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   a[0] = htobe16(a[0]);
   a[1] = htobe16(a[1]);
   a[2] = htobe16(a[2]);
@@ -52,7 +52,7 @@ static really_inline int32_t parse_ip4(
   const token_t *token)
 {
   if ((size_t)scan_ip4(token->data, rdata->octets) != token->length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(item), NAME(type));
+    SYNTAX_ERROR_IN(parser, item, type);
   rdata->octets += 4;
   return 0;
 }
@@ -195,7 +195,7 @@ static really_inline int32_t parse_ip6(
   const token_t *token)
 {
   if ((size_t)inet_pton6(token->data, rdata->octets) != token->length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(item), NAME(type));
+    SYNTAX_ERROR_IN(parser, item, type);
   rdata->octets += 16;
   return 0;
 }
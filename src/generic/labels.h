@@ -0,0 +1,29 @@
+/*
+ * labels.h -- index labels in domain name
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef LABELS_H
+#define LABELS_H
+
+// names are verified by the parser, follow length octets to find labels.
+// the root label is included
+nonnull_all
+static really_inline void index_labels(
+  zone_labels_t *labels, const uint8_t *octets, size_t length)
+{
+  size_t count = 0, offset = 0;
+
+  while (offset < length) {
+    labels->offsets[count++] = (uint8_t)offset;
+    offset += octets[offset] + 1;
+  }
+
+  assert(offset == length);
+  labels->count = (uint8_t)count;
+}
+
+#endif // LABELS_H
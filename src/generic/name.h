@@ -155,4 +155,18 @@ escaped:
   return carry == 0;
 }
 
+// canonical form (RFC 4034 section 6.2). names reside in padded buffers,
+// blocks are folded in full
+nonnull_all
+static really_inline void lower_name(uint8_t *octets, size_t length)
+{
+  simd_8x32_t block;
+
+  for (size_t count=0; count < length; count += 32) {
+    simd_loadu_8x32(&block, (const char *)octets + count);
+    simd_lower_8x32(&block);
+    simd_storeu_8x32(octets + count, &block);
+  }
+}
+
 #endif // NAME_H
@@ -29,7 +29,7 @@ static really_inline int32_t parse_nsap(
   // significance other than for readability and are not propagated in the
   // protocol (e.g., queries or zone transfers).
   if (unlikely(data[0] != '0' || !(data[1] == 'X' || data[1] == 'x')))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
 
   data += 2;
 
@@ -57,7 +57,7 @@ static really_inline int32_t parse_nsap(
     return 0;
 
 bad_sequence:
-  SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+  SYNTAX_ERROR_IN(parser, field, type);
 }
 
 #endif // NSAP_H
@@ -36,7 +36,7 @@ static really_inline int32_t parse_nsec(
       const mnemonic_t *mnemonic;
 
       if (scan_type(token->data, token->length, &code, &mnemonic) != 1)
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+        SYNTAX_ERROR_IN(parser, field, type);
 
       const uint8_t bit = (uint8_t)(code % 256);
       const uint8_t window = code / 256;
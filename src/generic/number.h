@@ -99,7 +99,7 @@ static really_inline int32_t parse_int8(
 {
   uint8_t number;
   if (!scan_int8(token->data, token->length, &number))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   *rdata->octets++ = number;
   return 0;
 }
@@ -114,7 +114,7 @@ static really_inline int32_t parse_int16(
 {
   uint16_t number;
   if (!scan_int16(token->data, token->length, &number))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   number = htobe16(number);
   memcpy(rdata->octets, &number, 2);
   rdata->octets += 2;
@@ -131,7 +131,7 @@ static really_inline int32_t parse_int32(
 {
   uint32_t number;
   if (!scan_int32(token->data, token->length, &number))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   number = htobe32(number);
   memcpy(rdata->octets, &number, 4);
   rdata->octets += 4;
@@ -148,7 +148,7 @@ static really_inline int32_t parse_int64(
 {
   uint64_t number;
   if (!scan_int64(token->data, token->length, &number))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   number = htobe64(number);
   memcpy(rdata->octets, &number, 8);
   rdata->octets += 8;
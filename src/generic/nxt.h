@@ -29,7 +29,7 @@ static really_inline int32_t parse_nxt(
 
   if (is_contiguous(token)) {
     if (scan_type(token->data, token->length, &code, &mnemonic) != 1)
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+      SYNTAX_ERROR_IN(parser, field, type);
     uint8_t bit = (uint8_t)(code % 8);
     uint8_t block = (uint8_t)(code / 8), highest_block = block;
 
@@ -39,7 +39,7 @@ static really_inline int32_t parse_nxt(
     take(parser, token);
     while (is_contiguous(token)) {
       if (scan_type(token->data, token->length, &code, &mnemonic) != 1)
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+        SYNTAX_ERROR_IN(parser, field, type);
       bit = (uint8_t)(code % 8);
       block = (uint8_t)(code / 8);
       if (block > highest_block) {
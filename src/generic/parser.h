@@ -192,8 +192,18 @@ extern int32_t zone_open_file(
 extern void zone_close_file(
   parser_t *, zone_file_t *);
 
+extern int32_t zone_include_file(
+  parser_t *, zone_file_t *, const char *);
+
 extern void zone_vlog(parser_t *, uint32_t, const char *, va_list);
 
+extern void zone_vdiagnose(
+  parser_t *, uint32_t, int32_t, const char *, const char *, const char *, va_list);
+
+extern int32_t zone_checkpoint(parser_t *, uint64_t);
+extern int32_t zone_flush(parser_t *);
+extern int32_t zone_reserve(parser_t *);
+
 nonnull((1))
 static really_inline void defer_error(token_t *token, int32_t code)
 {
@@ -202,18 +212,58 @@ static really_inline void defer_error(token_t *token, int32_t code)
   token->length = 0;
 }
 
-nonnull((1,3))
+// names of field and type are passed for structured diagnostics, either is
+// NULL if the error does not concern a single field or a specific type
+nonnull((1,5))
 warn_unused_result
 static never_inline int32_t raise_error(
-  parser_t *parser, int32_t code, const char *format, ...)
+  parser_t *parser,
+  int32_t code,
+  const char *field,
+  const char *type,
+  const char *format,
+  ...)
 {
   va_list arguments;
   uint32_t category = ZONE_ERROR;
   if (code == ZONE_SEMANTIC_ERROR && parser->options.secondary)
     category = ZONE_WARNING;
   va_start(arguments, format);
-  zone_vlog(parser, category, format, arguments);
+  zone_vdiagnose(parser, category, code, field, type, format, arguments);
+  va_end(arguments);
+  if (category == ZONE_WARNING)
+    return 0;
+  return code;
+}
+
+// report diagnostic without raising an error. errors in the lexer are
+// deferred, names of field and type are passed for structured diagnostics
+nonnull((1,6))
+static never_inline void report_error(
+  parser_t *parser,
+  uint32_t priority,
+  int32_t code,
+  const char *field,
+  const char *type,
+  const char *format,
+  ...)
+{
+  va_list arguments;
+  va_start(arguments, format);
+  zone_vdiagnose(parser, priority, code, field, type, format, arguments);
   va_end(arguments);
+}
+
+nonnull_all
+warn_unused_result
+static really_inline int32_t raise_invalid(
+  parser_t *parser, int32_t code, const char *field, const char *type)
+{
+  uint32_t category = ZONE_ERROR;
+  if (code == ZONE_SEMANTIC_ERROR && parser->options.secondary)
+    category = ZONE_WARNING;
+  report_error(
+    parser, category, code, field, type, "Invalid %s in %s", field, type);
   if (category == ZONE_WARNING)
     return 0;
   return code;
@@ -221,9 +271,12 @@ static never_inline int32_t raise_error(
 
 #define RAISE_ERROR(parser, code, ...) \
   do { \
-    return raise_error((parser), (code), __VA_ARGS__); \
+    return raise_error((parser), (code), NULL, NULL, __VA_ARGS__); \
   } while (0)
 
+#define RAISE_INVALID(parser, code, field, type) \
+  raise_invalid((parser), (code), NAME(field), NAME(type))
+
 #define SYNTAX_ERROR(parser, ...) \
   RAISE_ERROR((parser), ZONE_SYNTAX_ERROR, __VA_ARGS__)
 #define OUT_OF_MEMORY(parser, ...) \
@@ -245,7 +298,34 @@ static never_inline int32_t raise_error(
 // with the MSB set in order to update the zone
 #define SEMANTIC_ERROR(parser, ...) \
   do { \
-    if (raise_error((parser), ZONE_SEMANTIC_ERROR, __VA_ARGS__)) \
+    if (raise_error((parser), ZONE_SEMANTIC_ERROR, NULL, NULL, __VA_ARGS__)) \
+      return ZONE_SEMANTIC_ERROR; \
+  } while (0)
+
+// invalid field (rdata_info_t) in type (type_info_t)
+#define SYNTAX_ERROR_IN(parser, field, type) \
+  do { \
+    return RAISE_INVALID((parser), ZONE_SYNTAX_ERROR, (field), (type)); \
+  } while (0)
+
+#define SEMANTIC_ERROR_IN(parser, field, type) \
+  do { \
+    if (RAISE_INVALID((parser), ZONE_SEMANTIC_ERROR, (field), (type))) \
+      return ZONE_SEMANTIC_ERROR; \
+  } while (0)
+
+// error with a custom message, names of field and type are passed verbatim
+// to report messages like "Missing %s in %s" as structured diagnostics too
+#define SYNTAX_ERROR_AT(parser, field, type, ...) \
+  do { \
+    return raise_error( \
+      (parser), ZONE_SYNTAX_ERROR, (field), (type), __VA_ARGS__); \
+  } while (0)
+
+#define SEMANTIC_ERROR_AT(parser, field, type, ...) \
+  do { \
+    if (raise_error( \
+          (parser), ZONE_SEMANTIC_ERROR, (field), (type), __VA_ARGS__)) \
       return ZONE_SEMANTIC_ERROR; \
   } while (0)
 
@@ -286,6 +366,7 @@ static int32_t refill(parser_t *parser)
   assert((parser->file->buffer.data + parser->file->buffer.index) >= data);
   size_t index = (size_t)
     ((parser->file->buffer.data + parser->file->buffer.index) - data);
+  parser->file->buffer.offset += (uint64_t)(data - parser->file->buffer.data);
   memmove(parser->file->buffer.data, data, length);
   parser->file->buffer.length = length;
   parser->file->buffer.index = index;
@@ -297,7 +378,10 @@ static int32_t refill(parser_t *parser)
     if (parser->file->buffer.size >= MAXIMUM_WINDOW_SIZE)
       SYNTAX_ERROR(parser, "Impossibly large input, exceeds %zu bytes", size);
     size += ZONE_WINDOW_SIZE;
-    if (!(data = realloc(parser->file->buffer.data, size + 1 + ZONE_BLOCK_SIZE)))
+    if (!(data = parser->options.allocator.reallocate(
+            parser->options.allocator.context,
+            parser->file->buffer.data,
+            size + 1 + ZONE_BLOCK_SIZE)))
       OUT_OF_MEMORY(parser, "Not enough memory to allocate buffer of %zu", size);
     parser->file->buffer.size = size;
     parser->file->buffer.data = data;
@@ -352,6 +436,11 @@ static really_inline int32_t advance(parser_t *parser)
   if ((code = refill(parser)) < 0)
     return code;
 
+  // strings are not moved to the start of the buffer on refill
+  const char *start = parser->file->fields.tail != parser->file->fields.tape
+    ? parser->file->fields.tape[0]
+    : parser->file->buffer.data + parser->file->buffer.index;
+
   if (reindex(parser)) {
     // save non-terminated token
     parser->file->fields.tail[0] = parser->file->fields.tail[-1];
@@ -371,8 +460,8 @@ static really_inline int32_t advance(parser_t *parser)
     parser->file->buffer.data + parser->file->buffer.length;
   parser->file->delimiters.tail[0] =
     parser->file->buffer.data + parser->file->buffer.length;
-  // start-of-line must be false if start of tape is not start of buffer
-  if (*parser->file->fields.head != parser->file->buffer.data)
+  // start-of-line must be false if start of tape is not start of new data
+  if (*parser->file->fields.head != start)
     parser->file->start_of_line = false;
   return 0;
 }
@@ -423,7 +512,8 @@ static really_inline bool is_end_of_file(const token_t *token)
 #undef SYNTAX_ERROR
 #define SYNTAX_ERROR(parser, token, ...) \
   do { \
-    zone_log((parser), ZONE_ERROR, __VA_ARGS__); \
+    report_error( \
+      (parser), ZONE_ERROR, ZONE_SYNTAX_ERROR, NULL, NULL, __VA_ARGS__); \
     defer_error((token), ZONE_SYNTAX_ERROR); \
     return; \
   } while (0)
@@ -531,6 +621,7 @@ static really_inline void take(parser_t *parser, token_t *token)
 }
 
 #undef SYNTAX_ERROR
+#undef SYNTAX_ERROR_AT
 #undef ERROR
 
 // token sequence is predictable. fields typically require a specific type,
@@ -540,11 +631,28 @@ static really_inline void take(parser_t *parser, token_t *token)
 
 #define SYNTAX_ERROR(parser, token, ...) \
   do { \
-    zone_log((parser), ZONE_ERROR, __VA_ARGS__); \
+    report_error( \
+      (parser), ZONE_ERROR, ZONE_SYNTAX_ERROR, NULL, NULL, __VA_ARGS__); \
+    defer_error((token), ZONE_SYNTAX_ERROR); \
+    return ZONE_SYNTAX_ERROR; \
+  } while (0)
+
+#define SYNTAX_ERROR_AT(parser, token, field, type, ...) \
+  do { \
+    report_error( \
+      (parser), ZONE_ERROR, ZONE_SYNTAX_ERROR, (field), (type), __VA_ARGS__); \
     defer_error((token), ZONE_SYNTAX_ERROR); \
     return ZONE_SYNTAX_ERROR; \
   } while (0)
 
+#define INVALID(parser, token, field, type) \
+  SYNTAX_ERROR_AT((parser), (token), NAME(field), NAME(type), \
+                  "Invalid %s in %s", NAME(field), NAME(type))
+
+#define MISSING(parser, token, field, type) \
+  SYNTAX_ERROR_AT((parser), (token), NAME(field), NAME(type), \
+                  "Missing %s in %s", NAME(field), NAME(type))
+
 #define ERROR(parser, token, code) \
   do { \
     defer_error((token), (code)); \
@@ -563,9 +671,9 @@ static never_inline int32_t dont_have_contiguous(
     return token->code;
   assert(token->code != CONTIGUOUS);
   if (token->code == QUOTED)
-    SYNTAX_ERROR(parser, token, "Invalid %s in %s", NAME(field), NAME(type));
+    INVALID(parser, token, field, type);
   assert(token->code == END_OF_FILE || token->code == LINE_FEED);
-  SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+  MISSING(parser, token, field, type);
 }
 
 nonnull_all
@@ -603,11 +711,11 @@ static never_inline int32_t maybe_take_contiguous(
       return 0;
     } else if (token->code == END_OF_FILE) {
       if (parser->file->end_of_file == NO_MORE_DATA)
-        SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+        MISSING(parser, token, field, type);
       if ((code = advance(parser)) < 0)
         ERROR(parser, token, code);
     } else if (token->code == QUOTED) {
-      SYNTAX_ERROR(parser, token, "Invalid %s in %s", NAME(field), NAME(type));
+      INVALID(parser, token, field, type);
     } else if (token->code == LEFT_PAREN) {
       if (parser->file->grouped)
         SYNTAX_ERROR(parser, token, "Nested opening brace");
@@ -623,7 +731,7 @@ static never_inline int32_t maybe_take_contiguous(
         parser->file->span += *parser->file->newlines.head++;
       parser->file->span++;
       if (!parser->file->grouped)
-        SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+        MISSING(parser, token, field, type);
       parser->file->fields.head++;
     }
     token->data = *parser->file->fields.head;
@@ -663,9 +771,9 @@ static never_inline int32_t dont_have_quoted(
     return token->code;
   assert(token->code != QUOTED);
   if (token->code == CONTIGUOUS)
-    SYNTAX_ERROR(parser, token, "Invalid %s in %s", NAME(field), NAME(type));
+    INVALID(parser, token, field, type);
   assert(token->code == END_OF_FILE || token->code == LINE_FEED);
-  SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+  MISSING(parser, token, field, type);
 }
 
 nonnull_all
@@ -704,11 +812,11 @@ static never_inline int32_t maybe_take_quoted(
       return 0;
     } else if (token->code == END_OF_FILE) {
       if (parser->file->end_of_file == NO_MORE_DATA)
-        SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+        MISSING(parser, token, field, type);
       if ((code = advance(parser)) < 0)
         ERROR(parser, token, code);
     } else if (token->code == CONTIGUOUS) {
-      SYNTAX_ERROR(parser, token, "Invalid %s in %s", NAME(field), NAME(type));
+      INVALID(parser, token, field, type);
     } else if (token->code == LEFT_PAREN) {
       if (parser->file->grouped)
         SYNTAX_ERROR(parser, token, "Nested opening brace");
@@ -724,7 +832,7 @@ static never_inline int32_t maybe_take_quoted(
         parser->file->span += *parser->file->newlines.head++;
       parser->file->span++;
       if (!parser->file->grouped)
-        SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+        MISSING(parser, token, field, type);
       parser->file->fields.head++;
     } else {
       assert(token->code < 0);
@@ -767,7 +875,7 @@ static never_inline int32_t dont_have_contiguous_or_quoted(
   if (token->code == QUOTED || token->code < 0)
     return token->code;
   assert(token->code == END_OF_FILE || token->code == LINE_FEED);
-  SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+  MISSING(parser, token, field, type);
 }
 
 nonnull_all
@@ -811,7 +919,7 @@ static never_inline int32_t maybe_take_contiguous_or_quoted(
       return 0;
     } else if (token->code == END_OF_FILE) {
       if (parser->file->end_of_file == NO_MORE_DATA)
-        SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+        MISSING(parser, token, field, type);
       if ((code = advance(parser)) < 0)
         ERROR(parser, token, code);
     } else if (token->code == LEFT_PAREN) {
@@ -829,7 +937,7 @@ static never_inline int32_t maybe_take_contiguous_or_quoted(
         parser->file->span += *parser->file->newlines.head++;
       parser->file->span++;
       if (!parser->file->grouped)
-        SYNTAX_ERROR(parser, token, "Missing %s in %s", NAME(field), NAME(type));
+        MISSING(parser, token, field, type);
       parser->file->fields.head++;
     }
     token->data = *parser->file->fields.head;
@@ -894,7 +1002,8 @@ static never_inline int32_t dont_have_delimiter(
   if (token->code == END_OF_FILE || token->code < 0)
     return token->code;
   assert(token->code == CONTIGUOUS || token->code == QUOTED);
-  SYNTAX_ERROR(parser, token, "Trailing data in %s", NAME(type));
+  SYNTAX_ERROR_AT(
+    parser, token, NULL, NAME(type), "Trailing data in %s", NAME(type));
 }
 
 nonnull_all
@@ -953,7 +1062,8 @@ static never_inline int32_t maybe_take_delimiter(
       parser->file->fields.head++;
     } else {
       assert(token->code == CONTIGUOUS || token->code == QUOTED);
-      SYNTAX_ERROR(parser, token, "Trailing data in %s", NAME(type));
+      SYNTAX_ERROR_AT(
+        parser, token, NULL, NAME(type), "Trailing data in %s", NAME(type));
     }
     token->data = *parser->file->fields.head;
     token->code = (int32_t)classify[ (uint8_t)**parser->file->fields.head ];
@@ -981,10 +1091,19 @@ static really_inline int32_t take_delimiter(
 }
 
 #undef SYNTAX_ERROR
+#undef SYNTAX_ERROR_AT
+#undef INVALID
+#undef MISSING
 #undef ERROR
 
-// define SYNTAX_ERROR for the rest of the code base
+// define SYNTAX_ERROR and SYNTAX_ERROR_AT for the rest of the code base
 #define SYNTAX_ERROR(parser, ...) \
   RAISE_ERROR((parser), ZONE_SYNTAX_ERROR, __VA_ARGS__)
 
+#define SYNTAX_ERROR_AT(parser, field, type, ...) \
+  do { \
+    return raise_error( \
+      (parser), ZONE_SYNTAX_ERROR, (field), (type), __VA_ARGS__); \
+  } while (0)
+
 #endif // PARSER_H
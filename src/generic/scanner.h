@@ -295,12 +295,12 @@ static really_inline int32_t reindex(parser_t *parser)
   size_t left = parser->file->buffer.length - parser->file->buffer.index;
   const char *data = parser->file->buffer.data + parser->file->buffer.index;
   const char **tape = parser->file->fields.tail;
-  const char **tape_limit = parser->file->fields.tape + ZONE_TAPE_SIZE;
+  const char **tape_limit = parser->file->fields.tape + parser->file->tapes->size;
 
   if (left >= ZONE_BLOCK_SIZE) {
     const char *data_limit = parser->file->buffer.data +
                             (parser->file->buffer.length - ZONE_BLOCK_SIZE);
-    while (data <= data_limit && ((uintptr_t)tape_limit - (uintptr_t)tape) >= ZONE_BLOCK_SIZE) {
+    while (data <= data_limit && (size_t)(tape_limit - tape) >= ZONE_BLOCK_SIZE) {
       simd_loadu_8x64(&block.input, (const uint8_t *)data);
       scan(parser, &block);
       write_indexes(parser, &block, 0);
@@ -313,12 +313,14 @@ static really_inline int32_t reindex(parser_t *parser)
     left = parser->file->buffer.length - parser->file->buffer.index;
   }
 
-  // only scan partial blocks after reading all data
-  if (parser->file->end_of_file) {
-    assert(left < ZONE_BLOCK_SIZE);
+  // only scan partial blocks after reading all data. full blocks may
+  // remain if the tape filled up first
+  assert(!parser->file->end_of_file || left < ZONE_BLOCK_SIZE ||
+         (size_t)(tape_limit - tape) < ZONE_BLOCK_SIZE);
+  if (parser->file->end_of_file && left < ZONE_BLOCK_SIZE) {
     if (!left) {
       parser->file->end_of_file = NO_MORE_DATA;
-    } else if (((uintptr_t)tape_limit - (uintptr_t)tape) >= left) {
+    } else if ((size_t)(tape_limit - tape) >= left) {
       // input is required to be padded, but may contain garbage
       uint8_t buffer[ZONE_BLOCK_SIZE] = { 0 };
       memcpy(buffer, data, left);
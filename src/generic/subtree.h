@@ -0,0 +1,64 @@
+/*
+ * subtree.h -- test if owner is at or below subtree root
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef SUBTREE_H
+#define SUBTREE_H
+
+// suffix comparison on the uncompressed wire format. the suffix must start
+// at a label boundary, which is verified by walking the labels of the
+// owner, and is compared case-insensitively
+nonnull_all
+static really_inline bool is_subdomain(
+  const uint8_t *octets, size_t length, const zone_name_t *root)
+{
+  if (root->length > length)
+    return false;
+
+  const size_t offset = length - root->length;
+  size_t label = 0;
+  while (label < offset)
+    label += octets[label] + 1;
+  if (label != offset)
+    return false;
+
+  return is_same_folded(octets + offset, root->octets, root->length);
+}
+
+nonnull_all
+static really_inline bool is_out_of_scope(
+  const zone_options_t *options, const uint8_t *octets, size_t length)
+{
+  for (size_t i=0; i < options->subtree.count; i++)
+    if (is_subdomain(octets, length, &options->subtree.roots[i]))
+      return false;
+  return true;
+}
+
+// records are skipped for as long as the owner matches the owner the accept
+// callback asked to skip, or is at or below it for subtrees
+nonnull_all
+static really_inline void update_scope(
+  parser_t *parser, const uint8_t *octets, size_t length)
+{
+  if (unlikely(parser->skip.code)) {
+    const zone_name_t *owner =
+      &(zone_name_t){ (uint8_t)parser->skip.owner.length, parser->skip.owner.octets };
+    if ((parser->skip.code == ZONE_SKIP_SUBTREE || length == owner->length) &&
+        is_subdomain(octets, length, owner)) {
+      parser->out_of_scope = true;
+      return;
+    }
+    parser->skip.code = 0;
+    parser->out_of_scope = false;
+  }
+
+  if (unlikely(parser->options.subtree.count))
+    parser->out_of_scope = is_out_of_scope(&parser->options, octets, length);
+}
+
+#endif // SUBTREE_H
@@ -106,14 +106,16 @@ static int32_t parse_alpn(
     if (unlikely(*rdata->octets == '\\')) {
       uint32_t length;
       if (!(length = unescape(data, rdata->octets)))
-        SYNTAX_ERROR(parser, "Invalid alpn in %s", NAME(type));
+        SYNTAX_ERROR_AT(parser, "alpn", NAME(type),
+                        "Invalid alpn in %s", NAME(type));
       data += length;
       // second level escape processing
       if (*rdata->octets == '\\') {
         assert(length);
         if (*data == '\\') {
           if (!(length = unescape(data, rdata->octets)))
-            SYNTAX_ERROR(parser, "Invalid alpn in %s", NAME(type));
+            SYNTAX_ERROR_AT(parser, "alpn", NAME(type),
+                            "Invalid alpn in %s", NAME(type));
           data += length;
         } else {
           *rdata->octets = (uint8_t)*data;
@@ -130,7 +132,8 @@ static int32_t parse_alpn(
       assert(comma < rdata->octets);
       const size_t length = ((uintptr_t)rdata->octets - (uintptr_t)comma) - 1;
       if (!length || length > 255)
-        SYNTAX_ERROR(parser, "Invalid alpn in %s", NAME(type));
+        SYNTAX_ERROR_AT(parser, "alpn", NAME(type),
+                        "Invalid alpn in %s", NAME(type));
       *comma = (uint8_t)length;
       comma = rdata->octets;
     }
@@ -139,10 +142,12 @@ static int32_t parse_alpn(
   }
 
   if (data != limit || rdata->octets > rdata->limit)
-    SYNTAX_ERROR(parser, "Invalid alpn in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "alpn", NAME(type),
+                    "Invalid alpn in %s", NAME(type));
   const size_t length = ((uintptr_t)rdata->octets - (uintptr_t)comma) - 1;
   if (!length || length > 255)
-    SYNTAX_ERROR(parser, "Invalid alpn in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "alpn", NAME(type),
+                    "Invalid alpn in %s", NAME(type));
   *comma = (uint8_t)length;
   return 0;
 }
@@ -164,7 +169,8 @@ static int32_t parse_port(
   (void)param;
 
   if (!token->length || token->length > 5)
-    SYNTAX_ERROR(parser, "Invalid port in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "port", NAME(type),
+                    "Invalid port in %s", NAME(type));
 
   uint64_t number = 0;
   for (;; data++) {
@@ -180,9 +186,10 @@ static int32_t parse_port(
   rdata->octets += 2;
 
   if (rdata->octets > rdata->limit)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   if (data != token->data + token->length || number > 65535)
-    SYNTAX_ERROR(parser, "Invalid port in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "port", NAME(type),
+                    "Invalid port in %s", NAME(type));
   return 0;
 }
 
@@ -204,21 +211,25 @@ static int32_t parse_ipv4hint(
   (void)param;
 
   if ((n = (size_t)scan_ip4(t, rdata->octets)) == 0)
-    SYNTAX_ERROR(parser, "Invalid ipv4hint in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "ipv4hint", NAME(type),
+                    "Invalid ipv4hint in %s", NAME(type));
   rdata->octets += 4;
   t += n;
 
   while (*t == ',') {
     if (rdata->octets > rdata->limit)
-      SYNTAX_ERROR(parser, "Invalid ipv4hint in %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, "ipv4hint", NAME(type),
+                      "Invalid ipv4hint in %s", NAME(type));
     if ((n = (size_t)scan_ip4(t + 1, rdata->octets)) == 0)
-      SYNTAX_ERROR(parser, "Invalid ipv4hint in %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, "ipv4hint", NAME(type),
+                      "Invalid ipv4hint in %s", NAME(type));
     rdata->octets += 4;
     t += n + 1;
   }
 
   if (t != te || rdata->octets > rdata->limit)
-    SYNTAX_ERROR(parser, "Invalid ipv4hint in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "ipv4hint", NAME(type),
+                    "Invalid ipv4hint in %s", NAME(type));
   return 0;
 }
 
@@ -245,11 +256,11 @@ static int32_t parse_ech(
   struct base64_state state = { .eof = 0, .bytes = 0, .carry = 0 };
   if (!base64_stream_decode(
     &state, token->data, token->length, rdata->octets, &length))
-    SYNTAX_ERROR(parser, "Invalid ech in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "ech", NAME(type), "Invalid ech in %s", NAME(type));
 
   rdata->octets += length;
   if (state.bytes)
-    SYNTAX_ERROR(parser, "Invalid ech in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "ech", NAME(type), "Invalid ech in %s", NAME(type));
 
   return 0;
 }
@@ -272,21 +283,25 @@ static int32_t parse_ipv6hint(
   (void)param;
 
   if ((n = (size_t)scan_ip6(t, rdata->octets)) == 0)
-    SYNTAX_ERROR(parser, "Invalid ipv6hint in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "ipv6hint", NAME(type),
+                    "Invalid ipv6hint in %s", NAME(type));
   rdata->octets += 16;
   t += n;
 
   while (*t == ',') {
     if (rdata->octets >= rdata->limit)
-      SYNTAX_ERROR(parser, "Invalid ipv6hint in %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, "ipv6hint", NAME(type),
+                      "Invalid ipv6hint in %s", NAME(type));
     if ((n = (size_t)scan_ip6(t + 1, rdata->octets)) == 0)
-      SYNTAX_ERROR(parser, "Invalid ipv6hint in %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, "ipv6hint", NAME(type),
+                      "Invalid ipv6hint in %s", NAME(type));
     rdata->octets += 16;
     t += n + 1;
   }
 
   if (t != te || rdata->octets > rdata->limit)
-    SYNTAX_ERROR(parser, "Invalid ipv6hint in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "ipv6hint", NAME(type),
+                    "Invalid ipv6hint in %s", NAME(type));
   return 0;
 }
 
@@ -316,7 +331,8 @@ static int32_t parse_dohpath(
     if (*t == '\\') {
       uint32_t o;
       if (!(o = unescape(t, rdata->octets)))
-        SYNTAX_ERROR(parser, "Invalid dohpath in %s", NAME(type));
+        SYNTAX_ERROR_AT(parser, "dohpath", NAME(type),
+                        "Invalid dohpath in %s", NAME(type));
       rdata->octets += 1; t += o;
     } else {
       rdata->octets += 1; t += 1;
@@ -330,7 +346,8 @@ static int32_t parse_dohpath(
   // FIXME: implement
 
   if (t != te || rdata->octets >= rdata->limit)
-    SYNTAX_ERROR(parser, "Invalid dohpath in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "dohpath", NAME(type),
+                    "Invalid dohpath in %s", NAME(type));
   return 0;
 }
 
@@ -354,7 +371,7 @@ static int32_t parse_unknown(
     if (*t == '\\') {
       uint32_t o;
       if (!(o = unescape(t, rdata->octets)))
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+        SYNTAX_ERROR_IN(parser, field, type);
       rdata->octets += 1; t += o;
     } else {
       rdata->octets += 1; t += 1;
@@ -362,7 +379,7 @@ static int32_t parse_unknown(
   }
 
   if (t != te || rdata->octets >= rdata->limit)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   return 0;
 }
 
@@ -397,12 +414,15 @@ static int32_t parse_tls_supported_groups(
     memcpy(rdata->octets, &group, 2);
     rdata->octets += 2;
     if (number > 65535)
-      SYNTAX_ERROR(parser, "Invalid tls-supported-group in %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, "tls-supported-group", NAME(type),
+                      "Invalid tls-supported-group in %s", NAME(type));
 
     const uint8_t *g;
     for (g = rdata_start; g < rdata->octets - 2; g += 2) {
       if (memcmp(g, &group, 2) == 0)
-        SEMANTIC_ERROR(parser, "Duplicate group in tls-supported-groups in %s", NAME(type));
+        SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                          "Duplicate group in tls-supported-groups in %s",
+                          NAME(type));
     }
     if (*t != ',')
       break;
@@ -411,7 +431,8 @@ static int32_t parse_tls_supported_groups(
   }
 
   if (t != te || rdata->octets > rdata->limit)
-    SYNTAX_ERROR(parser, "Invalid tls-supported-groups in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "tls-supported-groups", NAME(type),
+                    "Invalid tls-supported-groups in %s", NAME(type));
   return 0;
 }
 
@@ -593,7 +614,8 @@ static int32_t parse_mandatory(
   //   The presentation value SHALL be a comma-seperatred list of one or more
   //   valid SvcParamKeys, ...
   if (!(skip = scan_svc_param_key(data, &key)))
-    SYNTAX_ERROR(parser, "Invalid mandatory in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "mandatory", NAME(type),
+                    "Invalid mandatory in %s", NAME(type));
   if (key < 64)
     keys = 1llu << key;
 
@@ -605,7 +627,8 @@ static int32_t parse_mandatory(
 
   while (*data == ',' && rdata->octets < rdata->limit) {
     if (!(skip = scan_svc_param_key(data + 1, &key)))
-      SYNTAX_ERROR(parser, "Invalid mandatory of %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, "mandatory", NAME(type),
+                      "Invalid mandatory of %s", NAME(type));
 
     // check if key appears in automatically mandatory key list
     if (key < 64)
@@ -634,7 +657,8 @@ static int32_t parse_mandatory(
       // RFC9460 section 8:
       //   Keys MAY appear in any order, but MUST NOT appear more than once.
       if (key == smaller_key)
-        SEMANTIC_ERROR(parser, "Duplicate key in mandatory of %s", NAME(type));
+        SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                          "Duplicate key in mandatory of %s", NAME(type));
       assert(key < smaller_key);
       uint16_t length = (uint16_t)(rdata->octets - octets);
       memmove(octets + 2, octets, length);
@@ -645,11 +669,15 @@ static int32_t parse_mandatory(
   }
 
   if (keys & mandatory)
-    SEMANTIC_ERROR(parser, "Automatically mandatory key(s) in mandatory of %s", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Automatically mandatory key(s) in mandatory of %s",
+                      NAME(type));
   if (rdata->octets >= rdata->limit)
-    SYNTAX_ERROR(parser, "Invalid mandatory in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "mandatory", NAME(type),
+                    "Invalid mandatory in %s", NAME(type));
   if (data != token->data + token->length)
-    SYNTAX_ERROR(parser, "Invalid mandatory in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "mandatory", NAME(type),
+                    "Invalid mandatory in %s", NAME(type));
   return 0;
 }
 
@@ -686,7 +714,8 @@ static int32_t parse_mandatory_lax(
   //   The presentation value SHALL be a comma-seperatred list of one or more
   //   valid SvcParamKeys, ...
   if (!(skip = scan_svc_param_key(data, &key)))
-    SYNTAX_ERROR(parser, "Invalid key in %s of %s", NAME(param), NAME(type));
+    SYNTAX_ERROR_AT(parser, NAME(param), NAME(type),
+                    "Invalid key in %s of %s", NAME(param), NAME(type));
   if (key < 64)
     keys |= 1llu << key;
 
@@ -705,7 +734,8 @@ static int32_t parse_mandatory_lax(
 
   while (*data == ',' && rdata->octets < rdata->limit) {
     if (!(skip = scan_svc_param_key(data + 1, &key)))
-      SYNTAX_ERROR(parser, "Invalid key in %s of %s", NAME(param), NAME(type));
+      SYNTAX_ERROR_AT(parser, NAME(param), NAME(type),
+                      "Invalid key in %s of %s", NAME(param), NAME(type));
 
     // check if key appears in automatically mandatory key list
     if (key < 64)
@@ -728,7 +758,8 @@ static int32_t parse_mandatory_lax(
       // RFC9460 section 8:
       //   Keys MAY appear in any order, but MUST NOT appear more than once.
       if (key == smaller_key)
-        SEMANTIC_ERROR(parser, "Duplicate key in mandatory of %s", NAME(type));
+        SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                          "Duplicate key in mandatory of %s", NAME(type));
       assert(key < smaller_key);
       out_of_order = true;
     }
@@ -740,13 +771,16 @@ static int32_t parse_mandatory_lax(
   }
 
   if (keys & mandatory)
-    SEMANTIC_ERROR(parser, "Automatically mandatory key(s) in mandatory of %s", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Automatically mandatory key(s) in mandatory of %s",
+                      NAME(type));
   if (out_of_order)
-    SEMANTIC_ERROR(parser, "Out of order keys in mandatory of %s", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Out of order keys in mandatory of %s", NAME(type));
   if (rdata->octets >= rdata->limit - 2)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   if (data != token->data + token->length)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return 0;
 }
 
@@ -809,7 +843,8 @@ static really_inline int32_t check_mandatory(
   }
 
   if (missing_keys)
-    SEMANTIC_ERROR(parser, "Mandatory %s missing in %s", NAME(field), NAME(type));
+    SEMANTIC_ERROR_AT(parser, NAME(field), NAME(type),
+                      "Mandatory %s missing in %s", NAME(field), NAME(type));
   return 0;
 }
 
@@ -829,7 +864,8 @@ static really_inline int32_t parse_svc_param(
       return 0;
     case 1: // void parameter with value
       assert(token);
-      SEMANTIC_ERROR(parser, "%s with value in %s", NAME(field), NAME(type));
+      SEMANTIC_ERROR_AT(parser, NAME(field), NAME(type),
+                        "%s with value in %s", NAME(field), NAME(type));
       if (unlikely(!token->length))
         return 0;
       break;
@@ -841,12 +877,14 @@ static really_inline int32_t parse_svc_param(
         return 0;
       break;
     case 4: // parameter without value
-      SEMANTIC_ERROR(parser, "%s without value in %s", NAME(field), NAME(type));
+      SEMANTIC_ERROR_AT(parser, NAME(field), NAME(type),
+                        "%s without value in %s", NAME(field), NAME(type));
       return 0;
     case 5: // parameter with value
       assert(token);
       if (unlikely(!token->length))
-        SEMANTIC_ERROR(parser, "%s without value in %s", NAME(field), NAME(type));
+        SEMANTIC_ERROR_AT(parser, NAME(field), NAME(type),
+                          "%s without value in %s", NAME(field), NAME(type));
       break;
   }
 
@@ -875,7 +913,7 @@ static int32_t parse_svc_params_lax(
     const token_t *value = token;
 
     if (!(count = scan_svc_param(token->data, &key, &param)))
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+      SYNTAX_ERROR_IN(parser, field, type);
     assert(param);
 
     if (likely(key > highest_key))
@@ -914,7 +952,8 @@ static int32_t parse_svc_params_lax(
     assert(whence <= rdata->octets + 4);
 
     if (unlikely(out_of_order)) {
-      SEMANTIC_ERROR(parser, "Out of order %s in %s", NAME(field), NAME(type));
+      SEMANTIC_ERROR_AT(parser, NAME(field), NAME(type),
+                        "Out of order %s in %s", NAME(field), NAME(type));
     } else { // warn about missing or out-of-order parameters
       if (keys & 0x01)
         check_mandatory(parser, type, field, rdata, whence);
@@ -924,8 +963,9 @@ static int32_t parse_svc_params_lax(
       //   also be specified in order for the RR to be "self-consistent"
       //   (Section 2.4.3).
       if ((keys & 0x04) && !(keys & 0x02))
-        SEMANTIC_ERROR(parser, "%s with no-default-alpn but without alpn in %s",
-                       NAME(field), NAME(type));
+        SEMANTIC_ERROR_AT(parser, NAME(field), NAME(type),
+                          "%s with no-default-alpn but without alpn in %s",
+                          NAME(field), NAME(type));
     }
   }
 
@@ -957,7 +997,7 @@ static really_inline int32_t parse_svc_params(
     const svc_param_info_t *param;
 
     if (!(count = scan_svc_param(token->data, &key, &param)))
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+      SYNTAX_ERROR_IN(parser, field, type);
     assert(param);
 
     if (key < 64)
@@ -999,7 +1039,8 @@ static really_inline int32_t parse_svc_params(
 
       assert(octets < rdata->octets);
       if (key == smaller_key)
-        SEMANTIC_ERROR(parser, "Duplicate key in %s", NAME(type));
+        SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                          "Duplicate key in %s", NAME(type));
 
       rdata_t rdata_view;
       // RFC9460 section 2.2:
@@ -1042,8 +1083,9 @@ static really_inline int32_t parse_svc_params(
   //   be specified in order for the RR to be "self-consistent"
   //   (Section 2.4.3).
   if ((keys & 0x04) && !(keys & 0x02))
-    SEMANTIC_ERROR(parser, "%s with no-default-alpn but without alpn in %s",
-                   NAME(field), NAME(type));
+    SEMANTIC_ERROR_AT(parser, NAME(field), NAME(type),
+                      "%s with no-default-alpn but without alpn in %s",
+                      NAME(field), NAME(type));
   return 0;
 }
 
@@ -104,10 +104,10 @@ static really_inline int32_t parse_ttl(
 {
   uint32_t ttl;
   if (!scan_ttl(token->data, token->length, parser->options.pretty_ttls, &ttl))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   // FIXME: comment RFC2308 msb
   if (ttl & (1u << 31))
-    SEMANTIC_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SEMANTIC_ERROR_IN(parser, field, type);
   ttl = htobe32(ttl);
   memcpy(rdata->octets, &ttl, sizeof(ttl));
   rdata->octets += 4;
@@ -77,7 +77,8 @@ static really_inline int32_t check_bytes(
 {
   (void)data;
   if (length < size)
-    SYNTAX_ERROR(parser, "Missing %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_AT(parser, NAME(field), NAME(type),
+                    "Missing %s in %s", NAME(field), NAME(type));
   return (int32_t)size;
 }
 
@@ -106,13 +107,14 @@ static really_inline int32_t check_ttl(
   uint32_t number;
 
   if (length < sizeof(number))
-    SYNTAX_ERROR(parser, "Missing %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_AT(parser, NAME(field), NAME(type),
+                    "Missing %s in %s", NAME(field), NAME(type));
 
   memcpy(&number, data, sizeof(number));
   number = be32toh(number);
 
   if (number > INT32_MAX)
-    SEMANTIC_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SEMANTIC_ERROR_IN(parser, field, type);
 
   return 4;
 }
@@ -134,7 +136,7 @@ static really_inline int32_t check_name(
   }
 
   if (!count || count > (int32_t)length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
 
   return count;
 }
@@ -150,7 +152,7 @@ static really_inline int32_t check_string(
   int32_t count;
 
   if (!length || (count = 1 + (int32_t)data[0]) > (int32_t)length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
 
   return count;
 }
@@ -170,17 +172,19 @@ static really_inline int32_t check_nsec(
     const int32_t window = (int32_t)data[0];
     const int32_t blocks = (int32_t)data[1];
     if (window <= last_window)
-      SYNTAX_ERROR(parser, "Invalid %s in %s, windows are out-of-order",
-                   NAME(field), NAME(type));
+      SYNTAX_ERROR_AT(parser, NAME(field), NAME(type),
+                      "Invalid %s in %s, windows are out-of-order",
+                      NAME(field), NAME(type));
     if (!blocks || blocks > 32)
-      SYNTAX_ERROR(parser, "Invalid %s in %s, blocks are out-of-bounds",
-                   NAME(field), NAME(type));
+      SYNTAX_ERROR_AT(parser, NAME(field), NAME(type),
+                      "Invalid %s in %s, blocks are out-of-bounds",
+                      NAME(field), NAME(type));
     count += 2 + blocks;
     last_window = window;
   }
 
   if (count != (int32_t)length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
 
   return count;
 }
@@ -201,6 +205,228 @@ static really_inline void adjust_line_count(file_t *file)
   file->span = 0;
 }
 
+// owners are hashed in parse_owner, map the hash onto the range of
+// partitions by multiplication rather than modulo to avoid a division
+nonnull_all
+static really_inline int32_t accept_partitioned_rr(
+  parser_t *parser, uint16_t rdlength)
+{
+  const size_t partition = (size_t)
+    (((uint64_t)parser->owner_hash * parser->options.partition.count) >> 32);
+
+  assert(partition < parser->options.partition.count);
+  return parser->options.partition.callback(
+    parser,
+    partition,
+    &(zone_name_t){ (uint8_t)parser->owner->length, parser->owner->octets },
+    parser->file->last_type,
+    parser->file->last_class,
+    *parser->file->ttl,
+    rdlength,
+    parser->rdata->octets,
+    parser->user_data);
+}
+
+// every RR in a batch occupies an rdata buffer, owners are copied to the
+// owner buffers only if the owner differs from that of the previous RR
+nonnull_all
+static really_inline int32_t accept_batched_rr(
+  parser_t *parser, uint16_t rdlength)
+{
+  zone_batch_t *batch = parser->batch;
+  const size_t index = batch->count++;
+
+  if (index &&
+      batch->owners[index - 1].length == parser->owner->length &&
+      memcmp(batch->owners[index - 1].octets,
+             parser->owner->octets, parser->owner->length) == 0)
+  {
+    batch->owners[index] = batch->owners[index - 1];
+  } else {
+    zone_name_buffer_t *owner = &parser->buffers.owner.blocks[index];
+    memcpy(owner->octets, parser->owner->octets, parser->owner->length);
+    owner->length = parser->owner->length;
+    batch->owners[index] = (zone_name_t){ (uint8_t)owner->length, owner->octets };
+  }
+
+  batch->types[index] = parser->file->last_type;
+  batch->classes[index] = parser->file->last_class;
+  batch->ttls[index] = *parser->file->ttl;
+  batch->rdlengths[index] = rdlength;
+  batch->rdata[index] = parser->rdata->octets;
+  batch->hashes[index] = parser->owner_hash;
+
+  if (batch->count == parser->buffers.size)
+    return zone_flush(parser);
+  parser->buffers.rdata.active = batch->count;
+  parser->rdata = &parser->buffers.rdata.blocks[batch->count];
+  return 0;
+}
+
+nonnull_all
+static really_inline bool is_same_name(
+  const zone_name_t *name, const name_buffer_t *buffer)
+{
+  return name->length == buffer->length &&
+         is_same_folded(name->octets, buffer->octets, buffer->length);
+}
+
+// the owner is copied once per RRset. rdata buffers are used round-robin so
+// that the rdata of an RR that starts a new RRset remains in place
+nonnull_all
+static really_inline int32_t accept_rrset_rr(
+  parser_t *parser, uint16_t rdlength)
+{
+  zone_rrset_t *rrset = parser->rrset;
+  int32_t code;
+
+  // owner is unchanged if not stated
+  if (rrset->count && (rrset->type != parser->file->last_type ||
+                       rrset->class != parser->file->last_class ||
+                       (parser->owner_stated &&
+                        !is_same_name(&rrset->owner, parser->owner))) &&
+      (code = zone_flush(parser)) < 0)
+    return code;
+
+  parser->owner_stated = false;
+
+  if (!rrset->count) {
+    zone_name_buffer_t *owner = &parser->buffers.owner.blocks[0];
+    memcpy(owner->octets, parser->owner->octets, parser->owner->length);
+    owner->length = parser->owner->length;
+    rrset->owner = (zone_name_t){ (uint8_t)owner->length, owner->octets };
+    rrset->type = parser->file->last_type;
+    rrset->class = parser->file->last_class;
+    rrset->hash = parser->owner_hash;
+    if (parser->options.owner_labels)
+      rrset->labels = parser->labels;
+  }
+
+  const size_t index = rrset->count++;
+  rrset->ttls[index] = *parser->file->ttl;
+  rrset->rdlengths[index] = rdlength;
+  rrset->rdata[index] = parser->rdata->octets;
+
+  size_t active = parser->buffers.rdata.active + 1;
+  if (active == parser->buffers.size)
+    active = 0;
+  parser->buffers.rdata.active = active;
+  parser->rdata = &parser->buffers.rdata.blocks[active];
+
+  // flush before the rdata buffer of the first RR is reused
+  if (rrset->count == parser->buffers.size)
+    return zone_flush(parser);
+  return 0;
+}
+
+// RDATA is decoded in place, the owner is stored once, directly following
+// the RDATA of the first RR that references it
+nonnull_all
+static really_inline int32_t accept_packed_rr(
+  parser_t *parser, uint16_t rdlength)
+{
+  zone_arena_t *arena = parser->options.arena.arena;
+  zone_packed_rr_t *rr = (zone_packed_rr_t *)(void *)(arena->octets + arena->length);
+  size_t length = arena->length + offsetof(zone_packed_rr_t, rdata) + rdlength;
+
+  assert(parser->rdata->octets == rr->rdata);
+  if (parser->packed_owner == SIZE_MAX ||
+      (parser->owner_stated &&
+       (arena->octets[parser->packed_owner] != parser->owner->length ||
+        memcmp(arena->octets + parser->packed_owner + 1,
+               parser->owner->octets, parser->owner->length) != 0)))
+  {
+    arena->octets[length] = (uint8_t)parser->owner->length;
+    memcpy(arena->octets + length + 1,
+           parser->owner->octets, parser->owner->length);
+    parser->packed_owner = length;
+    length += 1 + parser->owner->length;
+  }
+
+  parser->owner_stated = false;
+  rr->owner = (uint32_t)parser->packed_owner;
+  rr->ttl = *parser->file->ttl;
+  rr->type = parser->file->last_type;
+  rr->class = parser->file->last_class;
+  rr->rdlength = rdlength;
+  arena->length = (length + 3) & ~(size_t)3;
+  arena->count++;
+  return zone_reserve(parser);
+}
+
+// hand RR to zone_next, a positive code stops the parse loop
+nonnull_all
+static really_inline int32_t yield_rr(parser_t *parser, uint16_t rdlength)
+{
+  zone_rr_t *rr = parser->rr;
+
+  rr->owner = (zone_name_t){ (uint8_t)parser->owner->length, parser->owner->octets };
+  rr->type = parser->file->last_type;
+  rr->class = parser->file->last_class;
+  rr->ttl = *parser->file->ttl;
+  rr->rdlength = rdlength;
+  rr->rdata = parser->rdata->octets;
+  return 1;
+}
+
+// applications may compile a kernel into their own translation unit with
+// ZONE_ACCEPT defined (template mode) for the accept function to be inlined
+#if defined ZONE_ACCEPT
+# define accept_callback(parser) ZONE_ACCEPT
+#else
+# define accept_callback(parser) ((parser)->options.accept.callback)
+#endif
+
+// the accept callback may ask to skip the remaining RRs of the owner, or of
+// the subtree, which are then skipped like RRs out of scope
+nonnull_all
+static never_inline int32_t skip_owner(parser_t *parser, int32_t code)
+{
+  if (code != ZONE_SKIP_OWNER && code != ZONE_SKIP_SUBTREE)
+    return code;
+  parser->skip.code = code;
+  parser->skip.owner.length = parser->owner->length;
+  memcpy(parser->skip.owner.octets, parser->owner->octets, parser->owner->length);
+  parser->out_of_scope = true;
+  return 0;
+}
+
+nonnull_all
+static never_inline int32_t deliver_rr(parser_t *parser, uint16_t rdlength)
+{
+  if (parser->lazy) {
+    parser->lazy->length = rdlength;
+    return 0;
+  }
+  if (parser->rr)
+    return yield_rr(parser, rdlength);
+
+  int32_t code;
+  if (parser->batch)
+    code = accept_batched_rr(parser, rdlength);
+  else if (parser->rrset)
+    code = accept_rrset_rr(parser, rdlength);
+  else if (parser->options.arena.arena)
+    code = accept_packed_rr(parser, rdlength);
+  else if (parser->options.partition.count)
+    code = accept_partitioned_rr(parser, rdlength);
+  else
+    code = accept_callback(parser)(
+      parser,
+      &(zone_name_t){ (uint8_t)parser->owner->length, parser->owner->octets },
+      parser->file->last_type,
+      parser->file->last_class,
+      *parser->file->ttl,
+      rdlength,
+      parser->rdata->octets,
+      parser->user_data);
+
+  // skip codes are honored for callbacks invoked for each RR
+  if (unlikely(code > 0) && !parser->batch && !parser->rrset)
+    code = skip_owner(parser, code);
+  return code;
+}
+
 nonnull_all
 static really_inline int32_t accept_rr(
   parser_t *parser, const type_info_t *type, const rdata_t *rdata)
@@ -213,15 +439,20 @@ static really_inline int32_t accept_rr(
 
   assert(length <= UINT16_MAX);
   assert(parser->owner->length <= UINT8_MAX);
-  int32_t code = parser->options.accept.callback(
-    parser,
-    &(zone_name_t){ (uint8_t)parser->owner->length, parser->owner->octets },
-    parser->file->last_type,
-    parser->file->last_class,
-    *parser->file->ttl,
-    (uint16_t)length,
-    parser->rdata->octets,
-    parser->user_data);
+  int32_t code;
+
+  if (unlikely(parser->custom_delivery))
+    code = deliver_rr(parser, (uint16_t)length);
+  else if (unlikely((code = accept_callback(parser)(
+      parser,
+      &(zone_name_t){ (uint8_t)parser->owner->length, parser->owner->octets },
+      parser->file->last_type,
+      parser->file->last_class,
+      *parser->file->ttl,
+      (uint16_t)length,
+      parser->rdata->octets,
+      parser->user_data)) > 0))
+    code = skip_owner(parser, code);
 
   adjust_line_count(parser->file);
   return code;
@@ -234,7 +465,7 @@ static int32_t check_a_rr(
   assert(rdata->octets >= parser->rdata->octets);
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets == 4)
     return accept_rr(parser, type, rdata);
-  SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+  SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
 }
 
 nonnull_all
@@ -267,7 +498,7 @@ static int32_t check_ns_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -307,7 +538,7 @@ static int32_t check_soa_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -368,7 +599,7 @@ static int32_t check_wks_rr(
   // any bit may, or may not, be set. confirm the bitmap does not exceed the
   // maximum number of ports
   if (n > 8192 + 5)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
 
   return accept_rr(parser, type, rdata);
 }
@@ -390,7 +621,7 @@ static int32_t parse_wks_rdata(
 
   uint8_t protocol;
   if (!scan_protocol(token->data, token->length, &protocol))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[1]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[1], type);
 
   *rdata->octets++ = protocol;
   uint8_t *bitmap = rdata->octets;
@@ -400,7 +631,7 @@ static int32_t parse_wks_rdata(
   while (is_contiguous(token)) {
     uint16_t port;
     if (!scan_service(token->data, token->length, protocol, &port))
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&type->rdata.fields[2]), NAME(type));
+      SYNTAX_ERROR_IN(parser, &type->rdata.fields[2], type);
 
     if (port > highest_port) {
       // ensure newly used octets are zeroed out before use
@@ -437,7 +668,7 @@ static int32_t check_hinfo_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -476,7 +707,7 @@ static int32_t check_minfo_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -515,7 +746,7 @@ static int32_t check_mx_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -557,7 +788,7 @@ static int32_t check_txt_rr(
       return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -593,7 +824,7 @@ static int32_t check_x25_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -630,7 +861,7 @@ static int32_t check_isdn_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -674,7 +905,7 @@ static int32_t check_rt_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -703,7 +934,7 @@ static int32_t check_nsap_rr(
   parser_t *parser, const type_info_t *type, const rdata_t *rdata)
 {
   if (rdata->octets == parser->rdata->octets)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -738,7 +969,7 @@ static int32_t check_nsap_ptr_rr(
       return r;
 
     if (c != n)
-      SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   }
 
   {
@@ -763,7 +994,7 @@ static int32_t check_nsap_ptr_rr(
 
     const uint8_t nsap_int[] = { 4, 'n', 's', 'a', 'p', 3, 'i', 'n', 't', 0 };
     if (strncasecmp((const char *)o + i, (const char *)nsap_int, 9) != 0 || !i || i + 10 != n)
-      SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   }
 
   return accept_rr(parser, type, rdata);
@@ -853,7 +1084,7 @@ static int32_t check_px_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s record", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s record", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -897,7 +1128,7 @@ static int32_t check_gpos_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s record", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s record", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -938,7 +1169,7 @@ static int32_t check_aaaa_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s record", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s record", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -963,7 +1194,7 @@ static int32_t check_loc_rr(
   parser_t *parser, const type_info_t *type, const rdata_t *rdata)
 {
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets != 16)
-    SYNTAX_ERROR(parser, "Invalid %s record", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s record", NAME(type));
   return accept_rr(parser, type, rdata);
 
   // FIXME: check validity of latitude, longitude and latitude?
@@ -989,7 +1220,7 @@ static int32_t parse_loc_rdata(
   if ((code = have_contiguous(parser, type, &fields[4], token)) < 0)
     return code;
   if (scan_degrees(token->data, token->length, &degrees) == -1)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[4]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[4], type);
   if ((code = take_contiguous(parser, type, &fields[4], token)) < 0)
     return code;
   if (scan_minutes(token->data, token->length, &minutes) == -1)
@@ -1009,7 +1240,7 @@ north_south:
   else if (token->data[0] == 'S')
     latitude = htobe32((1u<<31) - degrees);
   else
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[4]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[4], type);
 
   memcpy(&rdata->octets[4], &latitude, sizeof(latitude));
 
@@ -1017,7 +1248,7 @@ north_south:
   if ((code = take_contiguous(parser, type, &fields[5], token)) < 0)
     return code;
   if (scan_degrees(token->data, token->length, &degrees) == -1)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[5]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[5], type);
   if ((code = take_contiguous(parser, type, &fields[5], token)) < 0)
     return code;
   if (scan_minutes(token->data, token->length, &minutes) == -1)
@@ -1037,7 +1268,7 @@ east_west:
   else if (token->data[0] == 'W')
     longitude = htobe32((1u<<31) - degrees);
   else
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[5]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[5], type);
 
   memcpy(&rdata->octets[8], &longitude, sizeof(longitude));
 
@@ -1045,7 +1276,7 @@ east_west:
   if ((code = take_contiguous(parser, type, &fields[6], token)) < 0)
     return code;
   if (scan_altitude(token->data, token->length, &altitude) == -1)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[6]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[6], type);
 
   altitude = htobe32(altitude);
   memcpy(&rdata->octets[12], &altitude, sizeof(altitude));
@@ -1055,21 +1286,21 @@ east_west:
   if (!is_contiguous(token))
     goto skip_optional;
   if (scan_precision(token->data, token->length, &rdata->octets[1]))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[1]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[1], type);
 
   // horizontal precision
   take(parser, token);
   if (!is_contiguous(token))
     goto skip_optional;
   if (scan_precision(token->data, token->length, &rdata->octets[2]))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[2]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[2], type);
 
   // vertical precision
   take(parser, token);
   if (!is_contiguous(token))
     goto skip_optional;
   if (scan_precision(token->data, token->length, &rdata->octets[3]))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[3], type);
 
   take(parser, token);
 skip_optional:
@@ -1119,7 +1350,7 @@ static int32_t check_eid_rr(
   parser_t *parser, const type_info_t *type, const rdata_t *rdata)
 {
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets <= 0)
-    SYNTAX_ERROR(parser, "Invalid %s record", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s record", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1152,7 +1383,7 @@ static int32_t check_srv_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1191,7 +1422,7 @@ static int32_t check_atma_rr(
   assert(rdata->octets >= parser->rdata->octets);
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets > 2)
     return accept_rr(parser, type, rdata);
-  SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+  SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
 }
 
 nonnull_all
@@ -1264,7 +1495,7 @@ static int32_t check_cert_rr(
 
   assert(rdata->octets >= parser->rdata->octets);
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets < 6)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1303,7 +1534,7 @@ static int32_t check_sink_rr(
 
   assert(rdata->octets >= parser->rdata->octets);
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets < 3)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1349,7 +1580,7 @@ static int32_t parse_apl_rdata(
     int32_t length;
     const size_t size = (uintptr_t)rdata->limit - (uintptr_t)rdata->octets;
     if ((length = scan_apl(token->data, token->length, rdata->octets, size)) < 0)
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[0]), NAME(type));
+      SYNTAX_ERROR_IN(parser, &fields[0], type);
     assert(length == 8 /* ipv4 */ || length == 20 /* ipv6 */);
     rdata->octets += (size_t)length;
     take(parser, token);
@@ -1393,11 +1624,12 @@ static int32_t check_ds_rr(
     const uint8_t digest_size = digest_sizes[ digest_algorithm ];
 
     if (digest_size && n - 4 != digest_size)
-      SEMANTIC_ERROR(parser, "Invalid digest in %s", NAME(type));
+      SEMANTIC_ERROR_AT(parser, "digest", NAME(type),
+                        "Invalid digest in %s", NAME(type));
   }
 
   if (c > n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1444,7 +1676,8 @@ static int32_t parse_ds_rdata(
     size_t length = (uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets;
 
     if (digest_size && length - 4 != digest_size)
-      SEMANTIC_ERROR(parser, "Invalid digest in %s", NAME(type));
+      SEMANTIC_ERROR_AT(parser, "digest", NAME(type),
+                        "Invalid digest in %s", NAME(type));
   }
 
   return accept_rr(parser, type, rdata);
@@ -1467,13 +1700,16 @@ static int32_t check_sshfp_rr(
   // https://www.iana.org/assignments/dns-sshfp-rr-parameters
 
   if (c == n)
-    SYNTAX_ERROR(parser, "Missing %s in %s", NAME((&f[n!=0])), NAME(type));
+    SYNTAX_ERROR_AT(parser, NAME((&f[n!=0])), NAME(type),
+                    "Missing %s in %s", NAME((&f[n!=0])), NAME(type));
   else if (o[1] == 1 && (n - c) != 20)
-    SEMANTIC_ERROR(parser, "Wrong fingerprint size for type %s in %s",
-                           "SHA1", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Wrong fingerprint size for type %s in %s",
+                      "SHA1", NAME(type));
   else if (o[1] == 2 && (n - c) != 32)
-    SEMANTIC_ERROR(parser, "Wrong fingerprint size for type %s in %s",
-                           "SHA256", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Wrong fingerprint size for type %s in %s",
+                      "SHA256", NAME(type));
 
   return accept_rr(parser, type, rdata);
 }
@@ -1504,11 +1740,13 @@ static int32_t parse_sshfp_rdata(
   // https://www.iana.org/assignments/dns-sshfp-rr-parameters
   size_t fingerprint_size = (uintptr_t)rdata->octets - (uintptr_t)fingerprint;
   if (unlikely(*fingerprint_type == 1 && fingerprint_size != 20))
-    SEMANTIC_ERROR(parser, "Wrong fingerprint size for type %s in %s",
-                           "SHA1", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Wrong fingerprint size for type %s in %s",
+                      "SHA1", NAME(type));
   if (unlikely(*fingerprint_type == 2 && fingerprint_size != 32))
-    SEMANTIC_ERROR(parser, "Wrong fingerprint size for type %s in %s",
-                           "SHA256", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Wrong fingerprint size for type %s in %s",
+                      "SHA256", NAME(type));
 
   return accept_rr(parser, type, rdata);
 }
@@ -1589,17 +1827,18 @@ static int32_t check_ipseckey_rr(
         return r;
       break;
     default:
-      SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   }
 
   switch (parser->rdata->octets[2]) {
     case 0:
       if (c < n)
-        SYNTAX_ERROR(parser, "Trailing data in %s", NAME(t));
+        SYNTAX_ERROR_AT(parser, NULL, NAME(t), "Trailing data in %s", NAME(t));
       break;
     default:
       if (c >= n)
-        SYNTAX_ERROR(parser, "Missing %s in %s", NAME(&f[4]), NAME(t));
+        SYNTAX_ERROR_AT(parser, NAME(&f[4]), NAME(t),
+                        "Missing %s in %s", NAME(&f[4]), NAME(t));
       break;
   }
 
@@ -1632,7 +1871,7 @@ static int32_t parse_ipseckey_rdata(
   switch (octets[1]) {
     case 0: /* no gateway */
       if (token->length != 1 || token->data[0] != '.')
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(type));
+        SYNTAX_ERROR_IN(parser, &fields[3], type);
       break;
     case 1: /* IPv4 address */
       type = (const type_info_t *)ipseckey_ipv4;
@@ -1651,7 +1890,7 @@ static int32_t parse_ipseckey_rdata(
         return code;
       break;
     default:
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(type));
+      SYNTAX_ERROR_IN(parser, &fields[3], type);
   }
 
   take(parser, token);
@@ -1690,7 +1929,7 @@ static int32_t check_rrsig_rr(
     return r;
 
   if (c > n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1755,7 +1994,7 @@ static int32_t check_nsec_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1793,7 +2032,7 @@ static int32_t check_dnskey_rr(
     return r;
 
   if (c > n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1832,7 +2071,7 @@ static int32_t check_dhcid_rr(
   // 2-octet identifier type, 1-octet digest type, followed by one or more
   // octets representing the actual identifier
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets < 4)
-    SEMANTIC_ERROR(parser, "Invalid %s", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1868,7 +2107,7 @@ static int32_t check_nsec3_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1923,7 +2162,7 @@ static int32_t check_nsec3param_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -1971,7 +2210,7 @@ static int32_t check_tlsa_rr(
     return r;
 
   if (c >= n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2036,7 +2275,7 @@ static int32_t parse_hip_rdata(
     return code;
 
   if ((rdata->octets - octets) > 255 + 4)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[3], type);
   uint8_t hit_length = (uint8_t)((rdata->octets - octets) - 4);
   octets[0] = hit_length;
 
@@ -2068,7 +2307,7 @@ static int32_t check_openpgpkey_rr(
   // FIXME: as the RDATA contains a digest, it is likely we can make this
   //        check stricter, at least, for known algorithms
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets < 4)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2101,7 +2340,7 @@ static int32_t check_csync_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2154,7 +2393,8 @@ static int32_t check_zonemd_rr(
 
     const uint8_t digest_size = digest_sizes[ digest_algorithm ];
     if (digest_size && n - 6 != digest_size)
-      SEMANTIC_ERROR(parser, "Invalid digest in %s", NAME(type));
+      SEMANTIC_ERROR_AT(parser, "digest", NAME(type),
+                        "Invalid digest in %s", NAME(type));
   }
 
   return accept_rr(parser, type, rdata);
@@ -2196,7 +2436,8 @@ static int32_t parse_zonemd_rdata(
     const uint8_t digest_size = digest_sizes[ digest_algorithm ];
     size_t length = (uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets;
     if (digest_size && length - 6 != digest_size)
-      SEMANTIC_ERROR(parser, "Invalid digest in %s", NAME(type));
+      SEMANTIC_ERROR_AT(parser, "digest", NAME(type),
+                        "Invalid digest in %s", NAME(type));
   }
 
   return accept_rr(parser, type, rdata);
@@ -2297,10 +2538,11 @@ static int32_t check_dsync_rr(
   dsync_type = be16toh(dsync_type);
   if (dsync_scheme == 1 && dsync_type != ZONE_TYPE_CDS
                         && dsync_type != ZONE_TYPE_CSYNC)
-    SEMANTIC_ERROR(parser, "Wrong type for scheme 1 in %s", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Wrong type for scheme 1 in %s", NAME(type));
 
   if (c > n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2334,7 +2576,8 @@ static int32_t parse_dsync_rdata(
   dsync_type = be16toh(dsync_type);
   if (dsync_scheme == 1 && dsync_type != ZONE_TYPE_CDS
                         && dsync_type != ZONE_TYPE_CSYNC)
-    SEMANTIC_ERROR(parser, "Wrong type for scheme 1 in %s", NAME(type));
+    SEMANTIC_ERROR_AT(parser, NULL, NAME(type),
+                      "Wrong type for scheme 1 in %s", NAME(type));
 
   return accept_rr(parser, type, rdata);
 }
@@ -2353,7 +2596,7 @@ static int32_t check_nid_rr(
       (r = check(&c, check_ilnp64(parser, type, &f[1], o+c, n-c))))
     return r;
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2392,7 +2635,7 @@ static int32_t check_l32_rr(
     return r;
 
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2430,7 +2673,7 @@ static int32_t check_l64_rr(
       (r = check(&c, check_ilnp64(parser, type, &f[1], o+c, n-c))))
     return r;
   if (c != n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2459,7 +2702,7 @@ static int32_t check_eui48_rr(
   parser_t *parser, const type_info_t *type, const rdata_t *rdata)
 {
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets != 6)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2484,7 +2727,7 @@ static int32_t check_eui64_rr(
   parser_t *parser, const type_info_t *type, const rdata_t *rdata)
 {
   if ((uintptr_t)rdata->octets - (uintptr_t)parser->rdata->octets != 8)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2518,7 +2761,7 @@ static int32_t check_uri_rr(
       (r = check(&c, check_int16(parser, type, &f[1], o+c, n-c))))
     return r;
   if (c >= n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2560,7 +2803,7 @@ static int32_t check_caa_rr(
       (r = check(&c, check_int8(parser, type, &f[1], o+c, n-c))))
     return r;
   if (c >= n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2604,7 +2847,7 @@ static int32_t check_doa_rr(
       (r = check(&c, check_string(parser, type, &f[3], o+c, n-c))))
     return r;
   if (c > n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2711,10 +2954,10 @@ static int32_t check_amtrelay_rr(
         return r;
       break;
     default:
-      SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+      SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   }
   if (c < n)
-    SYNTAX_ERROR(parser, "Trailing data in %s", NAME(t));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(t), "Trailing data in %s", NAME(t));
   return accept_rr(parser, t, rdata);
 }
 
@@ -2735,7 +2978,7 @@ static int32_t parse_amtrelay_rdata(
   if ((code = take_contiguous(parser, type, &fields[1], token)) < 0)
     return code;
   if (token->length != 1)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[1]), NAME(type));
+    SYNTAX_ERROR_IN(parser, &fields[1], type);
   switch((char)*token->data) {
     case '0':
       D = 0x00;
@@ -2744,7 +2987,7 @@ static int32_t parse_amtrelay_rdata(
       D = 0x80;
       break;
     default :
-      SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[1]), NAME(type));
+      SYNTAX_ERROR_IN(parser, &fields[1], type);
   }
 
   if ((code = take_contiguous(parser, type, &fields[2], token)) < 0)
@@ -2773,7 +3016,7 @@ static int32_t parse_amtrelay_rdata(
           return code;
         break;
       default:
-        SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(&fields[3]), NAME(type));
+        SYNTAX_ERROR_IN(parser, &fields[3], type);
     }
   }
   octets[1] |= D;
@@ -2795,7 +3038,7 @@ static int32_t check_ipn_rr(
   if ((r = check(&c, check_int64(parser, type, &f[0], o, n))))
     return r;
   if (c > n)
-    SYNTAX_ERROR(parser, "Invalid %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, NULL, NAME(type), "Invalid %s", NAME(type));
   return accept_rr(parser, type, rdata);
 }
 
@@ -2859,7 +3102,8 @@ static int32_t parse_generic_rdata(
   if ((code = take_contiguous(parser, type, &fields[0], token)) < 0)
     return code;
   if (!scan_int16(token->data, token->length, &rdlength))
-    SYNTAX_ERROR(parser, "Invalid RDLENGTH in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "RDLENGTH", NAME(type),
+                    "Invalid RDLENGTH in %s", NAME(type));
 
   take(parser, token);
   if (is_contiguous(token)) {
@@ -2868,9 +3112,11 @@ static int32_t parse_generic_rdata(
     do {
       size_t length = token->length + 1 / 2;
       if (length > (uintptr_t)rdata->limit - (uintptr_t)rdata->octets)
-        SYNTAX_ERROR(parser, "Invalid RDATA in %s", NAME(type));
+        SYNTAX_ERROR_AT(parser, "RDATA", NAME(type),
+                        "Invalid RDATA in %s", NAME(type));
       if (!base16_stream_decode(&state, token->data, token->length, rdata->octets, &length))
-        SYNTAX_ERROR(parser, "Invalid RDATA in %s", NAME(type));
+        SYNTAX_ERROR_AT(parser, "RDATA", NAME(type),
+                        "Invalid RDATA in %s", NAME(type));
       rdata->octets += length;
       take(parser, token);
     } while (is_contiguous(token));
@@ -2882,7 +3128,8 @@ static int32_t parse_generic_rdata(
   if ((code = have_delimiter(parser, type, token)) < 0)
     return code;
   if (rdata->octets - parser->rdata->octets != rdlength)
-    SYNTAX_ERROR(parser, "Invalid RDATA in %s", NAME(type));
+    SYNTAX_ERROR_AT(parser, "RDATA", NAME(type),
+                    "Invalid RDATA in %s", NAME(type));
   return type->check(parser, type, rdata);
 }
 
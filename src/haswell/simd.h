@@ -78,9 +78,22 @@ static really_inline uint64_t simd_find_8x16(const simd_8x16_t *simd, char key)
   return m;
 }
 
+// fold ASCII letters to lowercase, octets >= 0x80 are negative and fall
+// outside the range
+nonnull_all
+static really_inline void simd_lower_8x(simd_8x_t *simd)
+{
+  const __m256i upper = _mm256_and_si256(
+    _mm256_cmpgt_epi8(simd->chunks[0], _mm256_set1_epi8('A' - 1)),
+    _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), simd->chunks[0]));
+  simd->chunks[0] = _mm256_or_si256(
+    simd->chunks[0], _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+
 #define simd_loadu_8x32(simd, address) simd_loadu_8x(simd, address)
 #define simd_storeu_8x32(address, simd) simd_storeu_8x(address, simd)
 #define simd_find_8x32(simd, key) simd_find_8x(simd, key)
+#define simd_lower_8x32(simd) simd_lower_8x(simd)
 
 nonnull_all
 static really_inline void simd_loadu_8x64(simd_8x64_t *simd, const uint8_t *address)
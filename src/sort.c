@@ -0,0 +1,477 @@
+/*
+ * sort.c -- canonical ordering of resource records
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "zone.h"
+#include "attributes.h"
+#include "diagnostic.h"
+#include "generic/fold.h"
+
+// records are stored back-to-back in a single buffer, header fields are in
+// host order and copied in and out to avoid alignment issues
+//
+//   owner length (1) | owner | type (2) | class (2) | ttl (4) | rdlength (2) | rdata
+#define HEADER_SIZE (10)
+
+// largest possible record
+#define RECORD_SIZE (1 + 255 + HEADER_SIZE + 65535)
+
+// switch to insertion sort for ranges of this size or less
+#define INSERTION_SORT_THRESHOLD (16)
+
+static really_inline size_t split_labels(
+  const uint8_t *octets, size_t length, uint8_t labels[128])
+{
+  size_t count = 0;
+  // owners are absolute and validated by the parser
+  for (size_t label=0; label < length; label += octets[label] + 1)
+    labels[count++] = (uint8_t)label;
+  return count;
+}
+
+// RFC 4034 section 6.1, names are sorted by their most significant (right
+// most) labels first, labels are compared as case insensitive octet strings
+static int compare_names(
+  const uint8_t *octets1, size_t length1,
+  const uint8_t *octets2, size_t length2)
+{
+  uint8_t labels1[128], labels2[128];
+  size_t count1 = split_labels(octets1, length1, labels1);
+  size_t count2 = split_labels(octets2, length2, labels2);
+
+  while (count1 && count2) {
+    const uint8_t *label1 = octets1 + labels1[--count1];
+    const uint8_t *label2 = octets2 + labels2[--count2];
+    const size_t length = label1[0] < label2[0] ? label1[0] : label2[0];
+    for (size_t i=1; i <= length; i++) {
+      const uint8_t octet1 = fold_octet(label1[i]), octet2 = fold_octet(label2[i]);
+      if (octet1 != octet2)
+        return octet1 < octet2 ? -1 : 1;
+    }
+    if (label1[0] != label2[0])
+      return label1[0] < label2[0] ? -1 : 1;
+  }
+
+  return (count1 > count2) - (count1 < count2);
+}
+
+static really_inline void read_record(
+  const uint8_t *data, size_t offset, zone_rr_t *rr)
+{
+  const uint8_t *octets = data + offset;
+  rr->owner.length = octets[0];
+  rr->owner.octets = octets + 1;
+  octets += 1 + octets[0];
+  memcpy(&rr->type, octets + 0, sizeof(rr->type));
+  memcpy(&rr->class, octets + 2, sizeof(rr->class));
+  memcpy(&rr->ttl, octets + 4, sizeof(rr->ttl));
+  memcpy(&rr->rdlength, octets + 8, sizeof(rr->rdlength));
+  rr->rdata = octets + HEADER_SIZE;
+}
+
+// owner, class, type and RDATA as a left-justified unsigned octet sequence
+// (RFC 4034 section 6.3). RRs that differ in TTL only compare equal
+static int compare_rrs(const zone_rr_t *rr1, const zone_rr_t *rr2)
+{
+  int order;
+
+  // consecutive RRs often share an owner
+  if (rr1->owner.length != rr2->owner.length ||
+      memcmp(rr1->owner.octets, rr2->owner.octets, rr1->owner.length) != 0)
+  {
+    order = compare_names(
+      rr1->owner.octets, rr1->owner.length, rr2->owner.octets, rr2->owner.length);
+    if (order)
+      return order;
+  }
+
+  if (rr1->class != rr2->class)
+    return rr1->class < rr2->class ? -1 : 1;
+  if (rr1->type != rr2->type)
+    return rr1->type < rr2->type ? -1 : 1;
+
+  const size_t length = rr1->rdlength < rr2->rdlength ? rr1->rdlength : rr2->rdlength;
+  if ((order = memcmp(rr1->rdata, rr2->rdata, length)))
+    return order;
+  return (rr1->rdlength > rr2->rdlength) - (rr1->rdlength < rr2->rdlength);
+}
+
+static really_inline int compare_records(
+  const uint8_t *data, size_t offset1, size_t offset2)
+{
+  zone_rr_t rr1, rr2;
+  read_record(data, offset1, &rr1);
+  read_record(data, offset2, &rr2);
+  return compare_rrs(&rr1, &rr2);
+}
+
+static void merge_records(
+  const uint8_t *data,
+  const size_t *records1, size_t count1,
+  const size_t *records2, size_t count2,
+  size_t *output)
+{
+  size_t index1 = 0, index2 = 0;
+
+  while (index1 < count1 && index2 < count2) {
+    // take from the first range if equal to keep the sort stable
+    if (compare_records(data, records2[index2], records1[index1]) < 0)
+      *output++ = records2[index2++];
+    else
+      *output++ = records1[index1++];
+  }
+
+  memcpy(output, records1 + index1, (count1 - index1) * sizeof(*output));
+  output += count1 - index1;
+  memcpy(output, records2 + index2, (count2 - index2) * sizeof(*output));
+}
+
+static void sort_records(
+  const uint8_t *data, size_t *records, size_t *scratch, size_t count)
+{
+  if (count <= INSERTION_SORT_THRESHOLD) {
+    for (size_t i=1; i < count; i++) {
+      const size_t record = records[i];
+      size_t j = i;
+      for (; j > 0 && compare_records(data, record, records[j-1]) < 0; j--)
+        records[j] = records[j-1];
+      records[j] = record;
+    }
+    return;
+  }
+
+  const size_t half = count / 2;
+  sort_records(data, records, scratch, half);
+  sort_records(data, records + half, scratch + half, count - half);
+  // skip merge if ranges are already in order
+  if (compare_records(data, records[half-1], records[half]) <= 0)
+    return;
+  merge_records(data, records, half, records + half, count - half, scratch);
+  memcpy(records, scratch, count * sizeof(*records));
+}
+
+static really_inline size_t record_size(const zone_rr_t *rr)
+{
+  return 1 + rr->owner.length + HEADER_SIZE + rr->rdlength;
+}
+
+// sorted runs are written to temporary files using the in-memory framing,
+// duplicates are removed before writing
+static never_inline int32_t spill_run(zone_sorter_t *sorter)
+{
+  FILE *file, **files;
+  zone_rr_t rr, last;
+
+  if (!(files = realloc(sorter->runs.files, (sorter->runs.count + 1) * sizeof(*files))))
+    return ZONE_OUT_OF_MEMORY;
+  sorter->runs.files = files;
+diagnostic_push()
+msvc_diagnostic_ignored(4996)
+  if (!(file = tmpfile()))
+    return ZONE_WRITE_ERROR;
+diagnostic_pop()
+  files[sorter->runs.count++] = file;
+
+  zone_sorter_sort(sorter);
+
+  for (size_t i=0; i < sorter->count; i++) {
+    read_record(sorter->data.octets, sorter->records[i], &rr);
+    if (i && compare_rrs(&last, &rr) == 0)
+      continue;
+    const size_t size = record_size(&rr);
+    if (fwrite(sorter->data.octets + sorter->records[i], 1, size, file) != size)
+      return ZONE_WRITE_ERROR;
+    last = rr;
+  }
+
+  if (fflush(file) != 0)
+    return ZONE_WRITE_ERROR;
+  sorter->count = 0;
+  sorter->data.length = 0;
+  sorter->sorted = false;
+  return ZONE_SUCCESS;
+}
+
+static really_inline size_t slice_start(
+  const zone_sorter_t *sorter, size_t slice, size_t slices)
+{
+  const size_t size = sorter->count / slices, rest = sorter->count % slices;
+  return slice * size + (slice < rest ? slice : rest);
+}
+
+void zone_sorter_init(zone_sorter_t *sorter)
+{
+  memset(sorter, 0, sizeof(*sorter));
+}
+
+int32_t zone_sorter_limit(zone_sorter_t *sorter, size_t memory)
+{
+  // records and offsets are allotted half of the memory each
+  if (sorter->count || sorter->runs.count || memory / 2 < RECORD_SIZE)
+    return ZONE_BAD_PARAMETER;
+  free(sorter->records);
+  free(sorter->scratch);
+  free(sorter->data.octets);
+  sorter->records = sorter->scratch = NULL;
+  sorter->data.octets = NULL;
+  sorter->capacity = sorter->data.capacity = 0;
+  sorter->limit = memory;
+  return ZONE_SUCCESS;
+}
+
+void zone_sorter_destroy(zone_sorter_t *sorter)
+{
+  for (size_t i=0; i < sorter->runs.count; i++)
+    (void)fclose(sorter->runs.files[i]);
+  free(sorter->runs.files);
+  free(sorter->records);
+  free(sorter->scratch);
+  free(sorter->data.octets);
+  memset(sorter, 0, sizeof(*sorter));
+}
+
+int32_t zone_sorter_add(
+  zone_sorter_t *sorter,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata)
+{
+  const size_t size = 1 + owner->length + HEADER_SIZE + rdlength;
+
+  if (sorter->limit) {
+    if (!sorter->data.octets) {
+      const size_t capacity = (sorter->limit / 2) / (2 * sizeof(size_t));
+      if (!(sorter->records = malloc(capacity * sizeof(size_t))) ||
+          !(sorter->scratch = malloc(capacity * sizeof(size_t))) ||
+          !(sorter->data.octets = malloc(sorter->limit / 2)))
+        return ZONE_OUT_OF_MEMORY;
+      sorter->capacity = capacity;
+      sorter->data.capacity = sorter->limit / 2;
+    }
+
+    int32_t code;
+    if ((sorter->count == sorter->capacity ||
+         sorter->data.capacity - sorter->data.length < size) &&
+        (code = spill_run(sorter)) < 0)
+      return code;
+  } else if (sorter->count == sorter->capacity) {
+    size_t capacity = sorter->capacity ? sorter->capacity * 2 : 1024;
+    size_t *records, *scratch;
+    if (!(records = realloc(sorter->records, capacity * sizeof(*records))))
+      return ZONE_OUT_OF_MEMORY;
+    sorter->records = records;
+    if (!(scratch = realloc(sorter->scratch, capacity * sizeof(*scratch))))
+      return ZONE_OUT_OF_MEMORY;
+    sorter->scratch = scratch;
+    sorter->capacity = capacity;
+  }
+
+  if (sorter->data.capacity - sorter->data.length < size) {
+    size_t capacity = sorter->data.capacity ? sorter->data.capacity : 65536;
+    while (capacity - sorter->data.length < size)
+      capacity *= 2;
+    uint8_t *octets;
+    if (!(octets = realloc(sorter->data.octets, capacity)))
+      return ZONE_OUT_OF_MEMORY;
+    sorter->data.octets = octets;
+    sorter->data.capacity = capacity;
+  }
+
+  uint8_t *octets = sorter->data.octets + sorter->data.length;
+  octets[0] = owner->length;
+  memcpy(octets + 1, owner->octets, owner->length);
+  octets += 1 + owner->length;
+  memcpy(octets + 0, &type, sizeof(type));
+  memcpy(octets + 2, &class, sizeof(class));
+  memcpy(octets + 4, &ttl, sizeof(ttl));
+  memcpy(octets + 8, &rdlength, sizeof(rdlength));
+  memcpy(octets + HEADER_SIZE, rdata, rdlength);
+
+  sorter->records[sorter->count++] = sorter->data.length;
+  sorter->data.length += size;
+  sorter->sorted = false;
+  return ZONE_SUCCESS;
+}
+
+void zone_sorter_sort_slice(zone_sorter_t *sorter, size_t slice, size_t slices)
+{
+  assert(slice < slices);
+  const size_t start = slice_start(sorter, slice, slices);
+  const size_t end = slice_start(sorter, slice + 1, slices);
+  sort_records(sorter->data.octets,
+               sorter->records + start, sorter->scratch + start, end - start);
+}
+
+void zone_sorter_merge(zone_sorter_t *sorter, size_t slices)
+{
+  size_t *records = sorter->records, *scratch = sorter->scratch;
+
+  assert(slices);
+  // merge adjacent pairs of sorted slices until one slice remains
+  for (size_t width=1; width < slices; width *= 2) {
+    for (size_t slice=0; slice < slices; slice += 2 * width) {
+      const size_t start = slice_start(sorter, slice, slices);
+      const size_t middle = slice_start(
+        sorter, slice + width < slices ? slice + width : slices, slices);
+      const size_t end = slice_start(
+        sorter, slice + 2 * width < slices ? slice + 2 * width : slices, slices);
+      merge_records(sorter->data.octets,
+                    records + start, middle - start,
+                    records + middle, end - middle,
+                    scratch + start);
+    }
+    sorter->records = scratch;
+    sorter->scratch = records;
+    records = sorter->records;
+    scratch = sorter->scratch;
+  }
+
+  sorter->sorted = true;
+}
+
+void zone_sorter_sort(zone_sorter_t *sorter)
+{
+  zone_sorter_sort_slice(sorter, 0, 1);
+  sorter->sorted = true;
+}
+
+size_t zone_sorter_size(const zone_sorter_t *sorter)
+{
+  return sorter->count;
+}
+
+void zone_sorter_get(const zone_sorter_t *sorter, size_t index, zone_rr_t *rr)
+{
+  assert(index < sorter->count);
+  read_record(sorter->data.octets, sorter->records[index], rr);
+}
+
+typedef struct cursor cursor_t;
+struct cursor {
+  zone_rr_t rr;
+  FILE *file; // NULL for RRs in memory
+  uint8_t *octets;
+  size_t index;
+};
+
+// returns 1 if an RR was read, 0 if the run is exhausted
+static int32_t next_record(zone_sorter_t *sorter, cursor_t *cursor)
+{
+  if (!cursor->file) {
+    if (cursor->index == sorter->count)
+      return 0;
+    read_record(sorter->data.octets, sorter->records[cursor->index++], &cursor->rr);
+    return 1;
+  }
+
+  uint8_t *octets = cursor->octets;
+  if (fread(octets, 1, 1, cursor->file) != 1)
+    return ferror(cursor->file) ? ZONE_READ_ERROR : 0;
+  const size_t length = octets[0] + HEADER_SIZE;
+  if (fread(octets + 1, 1, length, cursor->file) != length)
+    return ZONE_READ_ERROR;
+  read_record(octets, 0, &cursor->rr);
+  if (fread(octets + 1 + length, 1, cursor->rr.rdlength, cursor->file) != cursor->rr.rdlength)
+    return ZONE_READ_ERROR;
+  return 1;
+}
+
+static void sift_down(cursor_t **heap, size_t count, size_t index)
+{
+  for (;;) {
+    size_t least = index, left = 2 * index + 1, right = 2 * index + 2;
+    if (left < count && compare_rrs(&heap[left]->rr, &heap[least]->rr) < 0)
+      least = left;
+    if (right < count && compare_rrs(&heap[right]->rr, &heap[least]->rr) < 0)
+      least = right;
+    if (least == index)
+      return;
+    cursor_t *cursor = heap[index];
+    heap[index] = heap[least];
+    heap[least] = cursor;
+    index = least;
+  }
+}
+
+int32_t zone_sorter_drain(
+  zone_sorter_t *sorter, zone_sorted_t callback, void *user_data)
+{
+  const size_t runs = sorter->runs.count + 1;
+  cursor_t *cursors = NULL, **heap = NULL;
+  uint8_t *octets = NULL;
+  size_t count = 0;
+  int32_t code = ZONE_OUT_OF_MEMORY;
+
+  if (!sorter->sorted)
+    zone_sorter_sort(sorter);
+
+  // one buffer per run on disk and one for the last RR passed to callback
+  if (!(cursors = calloc(runs, sizeof(*cursors))) ||
+      !(heap = malloc(runs * sizeof(*heap))) ||
+      !(octets = malloc(runs * RECORD_SIZE)))
+    goto exit;
+
+  for (size_t i=0; i < runs; i++) {
+    cursors[i].octets = octets + i * RECORD_SIZE;
+    if (i < sorter->runs.count) {
+      cursors[i].file = sorter->runs.files[i];
+      if (fseek(cursors[i].file, 0, SEEK_SET) != 0) {
+        code = ZONE_READ_ERROR;
+        goto exit;
+      }
+    }
+    if ((code = next_record(sorter, &cursors[i])) < 0)
+      goto exit;
+    if (code)
+      heap[count++] = &cursors[i];
+  }
+
+  for (size_t i=count/2; i > 0; i--)
+    sift_down(heap, count, i - 1);
+
+  // last RR passed to callback is copied to detect duplicates
+  uint8_t *last_octets = octets + sorter->runs.count * RECORD_SIZE;
+  zone_rr_t last;
+  bool first = true;
+
+  code = ZONE_SUCCESS;
+  while (count) {
+    cursor_t *cursor = heap[0];
+    if (first || compare_rrs(&last, &cursor->rr) != 0) {
+      if ((code = callback(&cursor->rr, user_data)) < 0)
+        goto exit;
+      memcpy(last_octets, cursor->rr.owner.octets - 1, record_size(&cursor->rr));
+      read_record(last_octets, 0, &last);
+      first = false;
+    }
+
+    if ((code = next_record(sorter, cursor)) < 0)
+      goto exit;
+    if (!code)
+      heap[0] = heap[--count];
+    sift_down(heap, count, 0);
+  }
+
+  code = ZONE_SUCCESS;
+exit:
+  for (size_t i=0; i < sorter->runs.count; i++)
+    (void)fclose(sorter->runs.files[i]);
+  sorter->runs.count = 0;
+  sorter->count = 0;
+  sorter->data.length = 0;
+  free(cursors);
+  free(heap);
+  free(octets);
+  return code;
+}
@@ -0,0 +1,64 @@
+/*
+ * base16.h -- SSE4.1 Base16 block decoder
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef SIMD_BASE16_H
+#define SIMD_BASE16_H
+
+#include <stdint.h>
+#include <immintrin.h>
+
+// convert 16 hexadecimal digits to nibbles, returns false if any of the
+// characters is not a hexadecimal digit
+static really_inline bool base16_nibbles_sse41(__m128i *nibbles, __m128i v)
+{
+  const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+  // octets >= 0x80 are negative and fall outside both ranges
+  const __m128i digit = _mm_and_si128(
+    _mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+    _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+  const __m128i alpha = _mm_and_si128(
+    _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+    _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+  if (_mm_movemask_epi8(_mm_or_si128(digit, alpha)) != 0xffff)
+    return false;
+
+  *nibbles = _mm_blendv_epi8(
+    _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)),
+    _mm_sub_epi8(v, _mm_set1_epi8('0')),
+    digit);
+  return true;
+}
+
+// decode blocks of 32 hexadecimal digits for as long as input remains,
+// stops at the first block that contains a non-hexadecimal character and
+// leaves it, along with any trailing digits, to the generic decoder
+static really_inline void base16_dec_loop_sse41(
+  const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+{
+  // multiply the high nibble by 16 and add the low nibble
+  const __m128i weights = _mm_set1_epi16(0x0110);
+
+  while (*slen >= 32) {
+    __m128i hi, lo;
+    if (!base16_nibbles_sse41(&hi, _mm_loadu_si128((const __m128i *)(*s))) ||
+        !base16_nibbles_sse41(&lo, _mm_loadu_si128((const __m128i *)(*s + 16))))
+      return;
+    hi = _mm_maddubs_epi16(hi, weights);
+    lo = _mm_maddubs_epi16(lo, weights);
+    _mm_storeu_si128((__m128i *)(*o), _mm_packus_epi16(hi, lo));
+    *s += 32;
+    *o += 16;
+    *slen -= 32;
+    *olen += 16;
+  }
+}
+
+#define base16_dec_loop_simd base16_dec_loop_sse41
+
+#endif // SIMD_BASE16_H
@@ -0,0 +1,24 @@
+/*
+ * fold.h -- SSE4.2 ASCII case folding
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef SIMD_FOLD_H
+#define SIMD_FOLD_H
+
+#include <immintrin.h>
+
+// fold ASCII letters to lowercase, octets >= 0x80 are negative and fall
+// outside the range
+static really_inline __m128i fold_sse42(__m128i v)
+{
+  const __m128i upper = _mm_and_si128(
+    _mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+    _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+  return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+#endif // SIMD_FOLD_H
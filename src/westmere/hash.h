@@ -0,0 +1,50 @@
+/*
+ * hash.h -- SSE4.2 case-insensitive domain name hash
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef SIMD_HASH_H
+#define SIMD_HASH_H
+
+#include <stdint.h>
+#include <immintrin.h>
+
+// identical to the table driven CRC32C in generic/hash.h. owners reside in
+// name buffers, which are padded, so the last block may be loaded in full
+nonnull_all
+static really_inline uint32_t hash_name_sse42(
+  const uint8_t *octets, size_t length)
+{
+  uint32_t crc = 0xffffffffu;
+  size_t count = 0;
+
+  for (; length - count >= 16; count += 16) {
+    const __m128i v = fold_sse42(_mm_loadu_si128((const __m128i *)(octets + count)));
+#if defined(__x86_64__) || defined(_M_X64)
+    crc = (uint32_t)_mm_crc32_u64(crc, (uint64_t)_mm_cvtsi128_si64(v));
+    crc = (uint32_t)_mm_crc32_u64(crc, (uint64_t)_mm_extract_epi64(v, 1));
+#else
+    crc = _mm_crc32_u32(crc, (uint32_t)_mm_cvtsi128_si32(v));
+    crc = _mm_crc32_u32(crc, (uint32_t)_mm_extract_epi32(v, 1));
+    crc = _mm_crc32_u32(crc, (uint32_t)_mm_extract_epi32(v, 2));
+    crc = _mm_crc32_u32(crc, (uint32_t)_mm_extract_epi32(v, 3));
+#endif
+  }
+
+  if (count < length) {
+    uint8_t block[16];
+    _mm_storeu_si128((__m128i *)block,
+      fold_sse42(_mm_loadu_si128((const __m128i *)(octets + count))));
+    for (size_t i=0; i < length - count; i++)
+      crc = _mm_crc32_u8(crc, block[i]);
+  }
+
+  return ~crc;
+}
+
+#define hash_name_simd hash_name_sse42
+
+#endif // SIMD_HASH_H
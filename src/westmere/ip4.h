@@ -198,7 +198,7 @@ static really_inline int32_t parse_ip4(
 {
   // Note that this assumes that reading up to token->data + 16 is safe (i.e., we do not cross a page).
   if ((size_t)scan_ip4(token->data, rdata->octets) != token->length)
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
   rdata->octets += 4;
   return 0;
 }
@@ -9,6 +9,8 @@
 #include "zone.h"
 #include "attributes.h"
 #include "diagnostic.h"
+#include "generic/fold.h"
+#include "westmere/fold.h"
 #include "westmere/simd.h"
 #include "generic/endian.h"
 #include "westmere/bits.h"
@@ -21,6 +23,7 @@
 #include "generic/ip6.h"
 #include "generic/text.h"
 #include "generic/name.h"
+#include "westmere/base16.h"
 #include "generic/base16.h"
 #include "westmere/base32.h"
 #include "generic/base64.h"
@@ -38,16 +41,40 @@
 #include "generic/cert.h"
 #include "generic/atma.h"
 #include "generic/algorithm.h"
+#include "westmere/hash.h"
+#include "generic/hash.h"
+#include "generic/subtree.h"
+#include "generic/labels.h"
 #include "generic/types.h"
 #include "westmere/type.h"
 #include "generic/format.h"
+#if !defined ZONE_ACCEPT
+#include "generic/estimate.h"
+#endif
 
 diagnostic_push()
 clang_diagnostic_ignored(missing-prototypes)
 
+#if defined ZONE_ACCEPT
+// template mode, see zone_kernel_t
+#if !defined ZONE_PARSE
+# error "ZONE_PARSE must be defined in template mode"
+#endif
+
+int32_t ZONE_PARSE(parser_t *parser)
+{
+  return parse(parser);
+}
+#else
 int32_t zone_westmere_parse(parser_t *parser)
 {
   return parse(parser);
 }
 
+int32_t zone_westmere_estimate(parser_t *parser, zone_estimate_t *estimate)
+{
+  return estimate_zone(parser, estimate);
+}
+#endif
+
 diagnostic_pop()
@@ -78,6 +78,13 @@ static really_inline void simd_storeu_8x32(uint8_t *address, const simd_8x32_t *
   _mm_storeu_si128((__m128i *)(address+16), simd->chunks[1]);
 }
 
+nonnull_all
+static really_inline void simd_lower_8x32(simd_8x32_t *simd)
+{
+  simd->chunks[0] = fold_sse42(simd->chunks[0]);
+  simd->chunks[1] = fold_sse42(simd->chunks[1]);
+}
+
 nonnull_all
 static really_inline uint64_t simd_find_8x32(const simd_8x32_t *simd, char key)
 {
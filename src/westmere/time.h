@@ -133,7 +133,7 @@ static really_inline int32_t parse_time(
   if (unlikely(token->length != 14))
     return parse_int32(parser, type, field, rdata, token);
   if (!sse_parse_time(token->data, &time))
-    SYNTAX_ERROR(parser, "Invalid %s in %s", NAME(field), NAME(type));
+    SYNTAX_ERROR_IN(parser, field, type);
 
   time = htobe32(time);
   memcpy(rdata->octets, &time, sizeof(time));
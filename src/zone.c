@@ -30,6 +30,10 @@ typedef zone_file_t file_t;
 
 #include "attributes.h"
 #include "diagnostic.h"
+#include "generic/fold.h"
+#include "generic/hash.h"
+#include "generic/subtree.h"
+#include "generic/labels.h"
 
 #if _MSC_VER
 # define strcasecmp(s1, s2) _stricmp(s1, s2)
@@ -48,29 +52,36 @@ static const char not_a_file[] = "<string>";
 
 #if HAVE_HASWELL
 extern int32_t zone_haswell_parse(parser_t *);
+extern int32_t zone_haswell_estimate(parser_t *, zone_estimate_t *);
 #endif
 
 #if HAVE_WESTMERE
 extern int32_t zone_westmere_parse(parser_t *);
+extern int32_t zone_westmere_estimate(parser_t *, zone_estimate_t *);
 #endif
 
 extern int32_t zone_fallback_parse(parser_t *);
+extern int32_t zone_fallback_estimate(parser_t *, zone_estimate_t *);
+
+int32_t zone_flush(parser_t *);
+int32_t zone_reserve(parser_t *);
 
 typedef struct kernel kernel_t;
 struct kernel {
   const char *name;
   uint32_t instruction_set;
   int32_t (*parse)(parser_t *);
+  int32_t (*estimate)(parser_t *, zone_estimate_t *);
 };
 
 static const kernel_t kernels[] = {
 #if HAVE_HASWELL
-  { "haswell", AVX2, &zone_haswell_parse },
+  { "haswell", AVX2, &zone_haswell_parse, &zone_haswell_estimate },
 #endif
 #if HAVE_WESTMERE
-  { "westmere", SSE42|PCLMULQDQ, &zone_westmere_parse },
+  { "westmere", SSE42|PCLMULQDQ, &zone_westmere_parse, &zone_westmere_estimate },
 #endif
-  { "fallback", DEFAULT, &zone_fallback_parse }
+  { "fallback", DEFAULT, &zone_fallback_parse, &zone_fallback_estimate }
 };
 
 diagnostic_push()
@@ -101,14 +112,105 @@ select_kernel(void)
 
 diagnostic_pop()
 
+// kernels generated in template mode take precedence
+nonnull_all
+static inline zone_kernel_t select_parse(const parser_t *parser)
+{
+  if (parser->options.kernel)
+    return parser->options.kernel;
+  return select_kernel()->parse;
+}
+
+static void *default_malloc(void *context, size_t size)
+{
+  (void)context;
+  return malloc(size);
+}
+
+static void *default_realloc(void *context, void *pointer, size_t size)
+{
+  (void)context;
+  return realloc(pointer, size);
+}
+
+static void default_free(void *context, void *pointer)
+{
+  (void)context;
+  free(pointer);
+}
+
+// every allocation made for the parser goes through the allocator in the
+// options, which defaults to malloc, realloc and free
+nonnull_all
+static void use_default_allocator(zone_options_t *options)
+{
+  options->allocator.allocate = &default_malloc;
+  options->allocator.reallocate = &default_realloc;
+  options->allocator.release = &default_free;
+  options->allocator.context = NULL;
+}
+
+nonnull_all
+static inline void *zone_malloc(parser_t *parser, size_t size)
+{
+  return parser->options.allocator.allocate(
+    parser->options.allocator.context, size);
+}
+
+nonnull((1))
+static inline void zone_free(parser_t *parser, void *pointer)
+{
+  if (pointer)
+    parser->options.allocator.release(parser->options.allocator.context, pointer);
+}
+
+// batch or RRset holds RRs that have not been delivered yet
+nonnull_all
+static inline bool is_pending(const parser_t *parser)
+{
+  if (parser->batch)
+    return parser->batch->count != 0;
+  return parser->rrset && parser->rrset->count != 0;
+}
+
 static int32_t parse(parser_t *parser, void *user_data)
 {
-  const kernel_t *kernel;
+  int32_t code, flushed;
+  bool pending;
 
-  kernel = select_kernel();
-  assert(kernel);
+  assert(parser->kernel);
   parser->user_data = user_data;
-  return kernel->parse(parser);
+  if (!parser->custom_delivery && !parser->options.accept.callback &&
+      !parser->options.lazy.callback && !parser->options.kernel)
+    return ZONE_BAD_PARAMETER;
+  if (parser->options.batch.callback) {
+    if (!(parser->batch = zone_malloc(parser, sizeof(*parser->batch))))
+      return ZONE_OUT_OF_MEMORY;
+    parser->batch->count = 0;
+  } else if (parser->options.rrset.callback) {
+    if (!(parser->rrset = zone_malloc(parser, sizeof(*parser->rrset))))
+      return ZONE_OUT_OF_MEMORY;
+    parser->rrset->count = 0;
+  } else if (parser->options.arena.arena) {
+    if ((code = zone_reserve(parser)) < 0)
+      return code;
+    return parser->kernel(parser);
+  } else {
+    return parser->kernel(parser);
+  }
+
+  code = parser->kernel(parser);
+  // deliver RRs accepted before end of input or error
+  pending = is_pending(parser);
+  flushed = zone_flush(parser);
+  zone_free(parser, parser->batch);
+  zone_free(parser, parser->rrset);
+  parser->batch = NULL;
+  parser->rrset = NULL;
+  // code of last invocation is returned, like for the accept callback
+  if (code < 0 || !pending)
+    return code;
+  return flushed;
 }
 
 diagnostic_push()
@@ -121,15 +223,26 @@ msvc_diagnostic_ignored(4996)
 // Rooted paths, relative or not, unc and extended paths are never resolved
 // relative to the includer.
 nonnull_all
-static int32_t resolve_path(const char *include, char **path)
+static int32_t resolve_path(
+  parser_t *parser, const char *include, char **path)
 {
-  if ((*path = _fullpath(NULL, include, 0)))
-    return 0;
-  return (errno == ENOMEM) ? ZONE_OUT_OF_MEMORY : ZONE_NOT_A_FILE;
+  char *resolved;
+  char buffer[_MAX_PATH + 1];
+
+  if (!(resolved = _fullpath(buffer, include, sizeof(buffer))))
+    return (errno == ENOMEM) ? ZONE_OUT_OF_MEMORY : ZONE_NOT_A_FILE;
+  assert(resolved == buffer);
+  size_t length = strlen(buffer);
+  if (!(resolved = zone_malloc(parser, length + 1)))
+    return ZONE_OUT_OF_MEMORY;
+  memcpy(resolved, buffer, length + 1);
+  *path = resolved;
+  return 0;
 }
 #else
 nonnull_all
-static int32_t resolve_path(const char *include, char **path)
+static int32_t resolve_path(
+  parser_t *parser, const char *include, char **path)
 {
   char *resolved;
   char buffer[PATH_MAX + 1];
@@ -138,7 +251,7 @@ static int32_t resolve_path(const char *include, char **path)
     return (errno == ENOMEM) ? ZONE_OUT_OF_MEMORY : ZONE_NOT_A_FILE;
   assert(resolved == buffer);
   size_t length = strlen(buffer);
-  if (!(resolved = malloc(length + 1)))
+  if (!(resolved = zone_malloc(parser, length + 1)))
     return ZONE_OUT_OF_MEMORY;
   memcpy(resolved, buffer, length + 1);
   *path = resolved;
@@ -146,6 +259,58 @@ static int32_t resolve_path(const char *include, char **path)
 }
 #endif
 
+nonnull_all
+static zone_tapes_t *allocate_tapes(parser_t *parser, size_t size)
+{
+  zone_tapes_t *tapes;
+  const size_t fields = (size + 2) * sizeof(*tapes->fields);
+  const size_t delimiters = (size + 1) * sizeof(*tapes->delimiters);
+  const size_t newlines = (size + 1) * sizeof(*tapes->newlines);
+
+  assert(size >= 2 * ZONE_BLOCK_SIZE && size <= ZONE_TAPE_SIZE);
+  if (!(tapes = zone_malloc(parser, sizeof(*tapes) + fields + delimiters + newlines)))
+    return NULL;
+  tapes->size = size;
+  tapes->fields = (const char **)(void *)(tapes + 1);
+  tapes->delimiters = (const char **)(void *)((char *)tapes->fields + fields);
+  tapes->newlines = (uint16_t *)(void *)((char *)tapes->delimiters + delimiters);
+  return tapes;
+}
+
+// tapes are empty on attach, scanning starts at the current index
+nonnull_all
+static void attach_tapes(file_t *file, zone_tapes_t *tapes)
+{
+  const char *end = file->buffer.data + file->buffer.length;
+
+  file->tapes = tapes;
+  file->fields.tape = tapes->fields;
+  file->fields.tape[0] = end;
+  file->fields.tape[1] = end;
+  file->fields.head = file->fields.tail = file->fields.tape;
+  file->delimiters.tape = tapes->delimiters;
+  file->delimiters.tape[0] = NULL;
+  file->delimiters.head = file->delimiters.tail = file->delimiters.tape;
+  file->newlines.tape = tapes->newlines;
+  file->newlines.tape[0] = 0;
+  file->newlines.head = file->newlines.tail = file->newlines.tape;
+}
+
+// includers hand their tapes to the included file and are rescanned from
+// the start of the line following the $INCLUDE entry on return. the scanner
+// state is known at that point, i.e. not in a comment or quoted section
+nonnull_all
+static void rescan_file(file_t *file)
+{
+  assert(file->rescan <= file->buffer.length);
+  file->buffer.index = file->rescan;
+  // data is read, but not scanned
+  if (file->end_of_file)
+    file->end_of_file = 1;
+  memset(&file->state, 0, sizeof(file->state));
+  attach_tapes(file, file->tapes);
+}
+
 nonnull((1))
 static void close_file(
   parser_t *parser, file_t *file)
@@ -156,21 +321,36 @@ static void close_file(
 
   assert(!is_string || file == &parser->first);
   assert(!is_string || file->handle == NULL);
-  (void)parser;
 #ifndef NDEBUG
   const bool is_stdin = file->name &&
                         file->name != not_a_file &&
                         strcmp(file->name, "-") == 0;
   assert(!is_stdin || (!file->handle || file->handle == stdin));
 #endif
-  if (file->buffer.data && !is_string)
-    free(file->buffer.data);
+  // tapes of the top-level file are owned by the parser, tapes of included
+  // files are either borrowed from the includer or owned by the file
+  if (file != &parser->first && file->tapes) {
+    assert(file->includer);
+    if (file->tapes == file->includer->tapes)
+      rescan_file(file->includer);
+    else
+      zone_free(parser, file->tapes);
+  }
+  file->tapes = NULL;
+  // window of reusable parsers is retained, it may have been resized
+  if (file->buffer.data && !is_string && file == &parser->first &&
+      parser->cache.retain) {
+    parser->cache.window.data = file->buffer.data;
+    parser->cache.window.size = file->buffer.size;
+  } else if (file->buffer.data && !is_string) {
+    zone_free(parser, file->buffer.data);
+  }
   file->buffer.data = NULL;
   if (file->name && file->name != not_a_file)
-    free((char *)file->name);
+    zone_free(parser, (char *)file->name);
   file->name = NULL;
   if (file->path && file->path != not_a_file)
-    free((char *)file->path);
+    zone_free(parser, (char *)file->path);
   file->path = NULL;
   // stdin is not opened, it must not be closed
   if (file->handle && file->handle != stdin)
@@ -219,12 +399,76 @@ static void initialize_file(
   file->buffer.data = NULL;
   file->start_of_line = true;
   file->end_of_file = 1;
-  file->fields.tape[0] = NULL;
-  file->fields.head = file->fields.tail = file->fields.tape;
-  file->delimiters.tape[0] = NULL;
-  file->delimiters.head = file->delimiters.tail = file->delimiters.tape;
-  file->newlines.tape[0] = 0;
-  file->newlines.head = file->newlines.tail = file->newlines.tape;
+  file->tapes = NULL;
+  file->rescan = 0;
+}
+
+// tapes of the top-level file are retained by reusable parsers and grown if
+// the input requires more capacity
+nonnull_all
+static int32_t open_tapes(parser_t *parser, size_t size)
+{
+  zone_tapes_t *tapes = parser->cache.tapes;
+
+  if (!tapes || tapes->size < size) {
+    zone_free(parser, tapes);
+    parser->cache.tapes = NULL;
+    if (!(tapes = allocate_tapes(parser, size)))
+      return ZONE_OUT_OF_MEMORY;
+    parser->cache.tapes = tapes;
+  }
+
+  attach_tapes(&parser->first, tapes);
+  return 0;
+}
+
+// size window to fit small files, the window is grown on refill if the
+// file turns out to be larger
+nonnull_all
+static size_t window_size(FILE *handle)
+{
+#if _WIN32
+  __int64 size;
+  if (_fseeki64(handle, 0, SEEK_END) || (size = _ftelli64(handle)) < 0)
+    return ZONE_WINDOW_SIZE;
+  if (_fseeki64(handle, 0, SEEK_SET))
+    return ZONE_WINDOW_SIZE;
+#else
+  off_t size;
+  if (fseeko(handle, 0, SEEK_END) || (size = ftello(handle)) < 0)
+    return ZONE_WINDOW_SIZE;
+  if (fseeko(handle, 0, SEEK_SET))
+    return ZONE_WINDOW_SIZE;
+#endif
+  // end-of-file is detected on the first read if the file fits
+  if ((uint64_t)size >= ZONE_WINDOW_SIZE)
+    return ZONE_WINDOW_SIZE;
+  return (size_t)size + 1;
+}
+
+nonnull_all
+static int32_t open_window(parser_t *parser, file_t *file)
+{
+  const size_t size =
+    file->handle == stdin ? ZONE_WINDOW_SIZE : window_size(file->handle);
+
+  if (file == &parser->first && parser->cache.window.size >= size) {
+    file->buffer.data = parser->cache.window.data;
+    file->buffer.size = parser->cache.window.size;
+  } else {
+    if (file == &parser->first) {
+      zone_free(parser, parser->cache.window.data);
+      parser->cache.window.data = NULL;
+      parser->cache.window.size = 0;
+    }
+    if (!(file->buffer.data = zone_malloc(parser, size + 1 + ZONE_BLOCK_SIZE)))
+      return ZONE_OUT_OF_MEMORY;
+    file->buffer.size = size;
+  }
+
+  file->buffer.data[0] = '\0';
+  file->end_of_file = 0;
+  return 0;
 }
 
 nonnull_all
@@ -232,25 +476,17 @@ static int32_t open_file(
   parser_t *parser, file_t *file, const char *include, size_t length)
 {
   int32_t code;
-  const size_t size = ZONE_WINDOW_SIZE + 1 + ZONE_BLOCK_SIZE;
 
   initialize_file(parser, file);
 
   file->path = NULL;
-  if (!(file->name = malloc(length + 1)))
+  if (!(file->name = zone_malloc(parser, length + 1)))
     return ZONE_OUT_OF_MEMORY;
   memcpy(file->name, include, length);
   file->name[length] = '\0';
-  if (!(file->buffer.data = malloc(size)))
-    return (void)close_file(parser, file), ZONE_OUT_OF_MEMORY;
-  file->buffer.data[0] = '\0';
-  file->buffer.size = ZONE_WINDOW_SIZE;
-  file->end_of_file = 0;
-  file->fields.tape[0] = &file->buffer.data[0];
-  file->fields.tape[1] = &file->buffer.data[0];
 
   if(file == &parser->first && strcmp(file->name, "-") == 0) {
-    if (!(file->path = malloc(2)))
+    if (!(file->path = zone_malloc(parser, 2)))
       return (void)close_file(parser, file), ZONE_OUT_OF_MEMORY;
     file->path[0] = '-';
     file->path[1] = '\0';
@@ -260,16 +496,23 @@ static int32_t open_file(
     // file as file descriptors for pipes and sockets the entries will be
     // symoblic links whose content is the file type with the inode.
     // See NLnetLabs/nsd#380.
-    if ((code = resolve_path(file->name, &file->path)))
+    if ((code = resolve_path(parser, file->name, &file->path)))
       return (void)close_file(parser, file), code;
   }
 
-  if(strcmp(file->path, "-") == 0) {
+  if(strcmp(file->path, "-") == 0)
     file->handle = stdin;
-    return 0;
-  } else {
-    if ((file->handle = fopen(file->name, "rb")))
+  else
+    file->handle = fopen(file->name, "rb");
+
+  // tapes of included files are attached once the includer is known
+  if (file->handle) {
+    if ((code = open_window(parser, file)) == 0 && file == &parser->first)
+      code = open_tapes(parser, ZONE_TAPE_SIZE);
+    if (code == 0)
       return 0;
+    close_file(parser, file);
+    return code;
   }
 
   switch (errno) {
@@ -300,7 +543,7 @@ void zone_close_file(
   if (!file)
     return;
   close_file(parser, file);
-  free(file);
+  zone_free(parser, file);
 }
 
 nonnull_all
@@ -309,12 +552,12 @@ int32_t zone_open_file(
 {
   int32_t code;
 
-  if (!(*file = malloc(sizeof(**file))))
+  if (!(*file = zone_malloc(parser, sizeof(**file))))
     return ZONE_OUT_OF_MEMORY;
   if ((code = open_file(parser, *file, path, length)) == 0)
     return 0;
 
-  free(*file);
+  zone_free(parser, *file);
 
   const char *reason = NULL;
   switch (code) {
@@ -328,6 +571,28 @@ int32_t zone_open_file(
   return code;
 }
 
+// only the active file requires tapes. the includer hands its tapes to the
+// included file if the start of the line following the $INCLUDE entry is
+// known, the included file is given tapes of its own otherwise
+nonnull((1,2))
+int32_t zone_include_file(
+  parser_t *parser, zone_file_t *file, const char *next)
+{
+  zone_tapes_t *tapes;
+
+  assert(file->includer == parser->file);
+  if (next) {
+    parser->file->rescan = (size_t)(next - parser->file->buffer.data);
+    tapes = parser->file->tapes;
+  } else if (!(tapes = allocate_tapes(parser, ZONE_TAPE_SIZE))) {
+    return ZONE_OUT_OF_MEMORY;
+  }
+
+  attach_tapes(file, tapes);
+  parser->file = file;
+  return 0;
+}
+
 nonnull_all
 void zone_close(parser_t *parser)
 {
@@ -336,8 +601,34 @@ void zone_close(parser_t *parser)
     includer = file->includer;
     close_file(parser, file);
     if (file != &parser->first)
-      free(file);
+      zone_free(parser, file);
+  }
+  zone_free(parser, parser->batch);
+  zone_free(parser, parser->rrset);
+  parser->batch = NULL;
+  parser->rrset = NULL;
+  if (parser->cache.retain)
+    return;
+  zone_free(parser, parser->cache.tapes);
+  parser->cache.tapes = NULL;
+}
+
+static bool is_origin(const uint8_t *octets, size_t length)
+{
+  if (!octets || !length || length > 255)
+    return false;
+
+  const uint8_t *root = &octets[length - 1];
+  if (root[0] != 0)
+    return false;
+  const uint8_t *label = &octets[0];
+  while (label < root) {
+    if (root - label < label[0])
+      return false;
+    label += label[0] + 1;
   }
+
+  return label == root;
 }
 
 nonnull((1,2,3))
@@ -347,34 +638,70 @@ static int32_t initialize_parser(
   zone_buffers_t *buffers,
   void *user_data)
 {
-  if (!options->accept.callback)
+  // RRs are delivered by at most one of partition, batch, rrset or lazy.
+  // the accept callback is verified on parse as RRs may be pulled instead
+  const int modes = (options->partition.count != 0) +
+                    (options->batch.callback != NULL) +
+                    (options->rrset.callback != NULL) +
+                    (options->arena.arena != NULL);
+  if (modes + (options->lazy.callback != NULL) > 1)
     return ZONE_BAD_PARAMETER;
-  if (!options->default_ttl)
-    return ZONE_BAD_PARAMETER;
-  if (!options->secondary && options->default_ttl > INT32_MAX)
+  if (options->partition.count) {
+    if (!options->partition.callback)
+      return ZONE_BAD_PARAMETER;
+    if ((uint64_t)options->partition.count > UINT32_MAX)
+      return ZONE_BAD_PARAMETER;
+  }
+  if (!buffers->size)
     return ZONE_BAD_PARAMETER;
-  if (!options->origin.octets || !options->origin.length)
+  if (options->arena.arena) {
+    const zone_arena_t *arena = options->arena.arena;
+    if (((uintptr_t)arena->octets & 3) || (arena->length & 3))
+      return ZONE_BAD_PARAMETER;
+    if (arena->length > arena->size)
+      return ZONE_BAD_PARAMETER;
+  }
+  if (options->filter.count && !options->filter.types)
     return ZONE_BAD_PARAMETER;
-
-  const uint8_t *root = &options->origin.octets[options->origin.length - 1];
-  if (root[0] != 0)
+  if (options->subtree.count && !options->subtree.roots)
     return ZONE_BAD_PARAMETER;
-  const uint8_t *label = &options->origin.octets[0];
-  while (label < root) {
-    if (root - label < label[0])
+  for (size_t i=0; i < options->subtree.count; i++) {
+    const zone_name_t *root = &options->subtree.roots[i];
+    if (!root->octets || !root->length || root->octets[root->length - 1])
       return ZONE_BAD_PARAMETER;
-    label += label[0] + 1;
   }
-
-  if (label != root)
+  if (options->checkpoint.interval && !options->checkpoint.callback)
+    return ZONE_BAD_PARAMETER;
+  const int hooks = (options->allocator.allocate != NULL) +
+                    (options->allocator.reallocate != NULL) +
+                    (options->allocator.release != NULL);
+  if (hooks != 0 && hooks != 3)
+    return ZONE_BAD_PARAMETER;
+  if (!options->default_ttl)
+    return ZONE_BAD_PARAMETER;
+  if (!options->secondary && options->default_ttl > INT32_MAX)
+    return ZONE_BAD_PARAMETER;
+  if (!is_origin(options->origin.octets, options->origin.length))
     return ZONE_BAD_PARAMETER;
 
   const size_t size = offsetof(parser_t, file);
   memset(parser, 0, size);
   parser->options = *options;
   parser->user_data = user_data;
+  if (!hooks)
+    use_default_allocator(&parser->options);
   parser->file = &parser->first;
   parser->buffers.size = buffers->size;
+  if (modes && buffers->size > ZONE_BATCH_SIZE)
+    parser->buffers.size = ZONE_BATCH_SIZE;
+  parser->custom_delivery = modes != 0;
+  parser->packed_owner = SIZE_MAX;
+  parser->hash_owners = options->hash_owners || options->partition.count;
+  // bitmap for common types, remaining types are looked up in the list
+  for (size_t i=0; i < options->filter.count; i++)
+    if (options->filter.types[i] < 256)
+      parser->filter[options->filter.types[i] >> 6] |=
+        1ull << (options->filter.types[i] & 63);
   parser->buffers.owner.active = 0;
   parser->buffers.owner.blocks = buffers->owner;
   parser->buffers.rdata.active = 0;
@@ -389,17 +716,11 @@ static int32_t initialize_parser(
   return 0;
 }
 
-int32_t zone_open(
-  zone_parser_t *parser,
-  const zone_options_t *options,
-  zone_buffers_t *buffers,
-  const char *path,
-  void *user_data)
+nonnull_all
+static int32_t open_zone(parser_t *parser, const char *path)
 {
   int32_t code;
 
-  if ((code = initialize_parser(parser, options, buffers, user_data)) < 0)
-    return code;
   if ((code = open_file(parser, &parser->first, path, strlen(path))) == 0)
     return 0;
 
@@ -415,8 +736,119 @@ int32_t zone_open(
   return code;
 }
 
+nonnull_all
+static int32_t open_string(
+  parser_t *parser, const char *string, size_t length)
+{
+  if (!length || string[length] != '\0')
+    return ZONE_BAD_PARAMETER;
+  // checkpoints are only taken for files
+  parser->options.checkpoint.interval = 0;
+  initialize_file(parser, parser->file);
+  parser->file->buffer.data = (char *)string;
+  parser->file->buffer.size = length;
+  parser->file->buffer.length = length;
+  assert(parser->file->end_of_file == 1);
+
+  // tapes need not hold more than every token in the string
+  size_t size = ((length + ZONE_BLOCK_SIZE - 1) / ZONE_BLOCK_SIZE + 1) *
+                ZONE_BLOCK_SIZE;
+  if (size > ZONE_TAPE_SIZE)
+    size = ZONE_TAPE_SIZE;
+  return open_tapes(parser, size);
+}
+
+int32_t zone_open(
+  zone_parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const char *path,
+  void *user_data)
+{
+  int32_t code;
+
+  if ((code = initialize_parser(parser, options, buffers, user_data)) < 0)
+    return code;
+  parser->kernel = select_parse(parser);
+  return open_zone(parser, path);
+}
+
 diagnostic_pop()
 
+int32_t zone_next(parser_t *parser, zone_rr_t *rr)
+{
+  int32_t code;
+
+  if (parser->custom_delivery || parser->options.lazy.callback)
+    return ZONE_BAD_PARAMETER;
+
+  // kernel was resolved on open, RRs are delivered through deliver_rr
+  parser->rr = rr;
+  parser->custom_delivery = true;
+  code = parser->kernel(parser);
+  parser->custom_delivery = false;
+  parser->rr = NULL;
+  return code;
+}
+
+int32_t zone_parse_step(parser_t *parser, size_t records)
+{
+  int32_t code, flushed;
+  bool pending;
+  const bool custom_delivery = parser->custom_delivery;
+
+  if (!records || parser->rr || parser->options.lazy.callback)
+    return ZONE_BAD_PARAMETER;
+  if (!custom_delivery && !parser->options.accept.callback &&
+      !parser->options.kernel)
+    return ZONE_BAD_PARAMETER;
+  // batches and RRsets persist between steps, released on close
+  if (parser->options.batch.callback && !parser->batch) {
+    if (!(parser->batch = zone_malloc(parser, sizeof(*parser->batch))))
+      return ZONE_OUT_OF_MEMORY;
+    parser->batch->count = 0;
+  } else if (parser->options.rrset.callback && !parser->rrset) {
+    if (!(parser->rrset = zone_malloc(parser, sizeof(*parser->rrset))))
+      return ZONE_OUT_OF_MEMORY;
+    parser->rrset->count = 0;
+  }
+
+  if (parser->options.arena.arena && (code = zone_reserve(parser)) < 0)
+    return code;
+
+  // the parse loop spends the budget for every RR, delivered or skipped
+  parser->budget = records;
+  parser->custom_delivery = true;
+  code = parser->kernel(parser);
+  parser->custom_delivery = custom_delivery;
+  parser->budget = 0;
+  if (code == ZONE_AGAIN || !(parser->batch || parser->rrset))
+    return code;
+  // deliver RRs accepted before end of input or error
+  pending = is_pending(parser);
+  flushed = zone_flush(parser);
+  if (code < 0 || !pending)
+    return code;
+  return flushed;
+}
+
+uint32_t zone_owner_hash(const zone_parser_t *parser)
+{
+  return parser->owner_hash;
+}
+
+const zone_labels_t *zone_owner_labels(const zone_parser_t *parser)
+{
+  return &parser->labels;
+}
+
+int32_t zone_decode_rdata(
+  zone_lazy_rdata_t *rdata, zone_rdata_buffer_t *buffer)
+{
+  // decoder is specific to the kernel that invoked the callback
+  return rdata->decode(rdata, buffer);
+}
+
 int32_t zone_parse(
   zone_parser_t *parser,
   const zone_options_t *options,
@@ -445,16 +877,544 @@ int32_t zone_parse_string(
 
   if ((code = initialize_parser(parser, options, buffers, user_data)) < 0)
     return code;
-  if (!length || string[length] != '\0')
+  parser->kernel = select_parse(parser);
+  if ((code = open_string(parser, string, length)) < 0)
+    return code;
+  code = parse(parser, user_data);
+  zone_close(parser);
+  return code;
+}
+
+int32_t zone_estimate(
+  parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const char *path,
+  zone_estimate_t *estimate)
+{
+  int32_t code;
+  const kernel_t *kernel;
+
+  if ((code = initialize_parser(parser, options, buffers, NULL)) < 0)
+    return code;
+  kernel = select_kernel();
+  parser->kernel = kernel->parse;
+  if ((code = open_zone(parser, path)) < 0)
+    return code;
+  memset(estimate, 0, sizeof(*estimate));
+  code = kernel->estimate(parser, estimate);
+  zone_close(parser);
+  return code;
+}
+
+// RRs other than SOA are skipped without decoding RDATA, RRs are pulled so
+// that parsing stops at the first SOA RR
+nonnull_all
+static void prepare_peek(zone_options_t *options)
+{
+  static const uint16_t soa[] = { ZONE_TYPE_SOA };
+
+  options->filter.types = soa;
+  options->filter.count = 1;
+  options->filter.deny = false;
+  options->subtree.count = 0;
+  options->partition.count = 0;
+  options->batch.callback = NULL;
+  options->rrset.callback = NULL;
+  options->arena.arena = NULL;
+  options->lazy.callback = NULL;
+  options->checkpoint.interval = 0;
+}
+
+static uint32_t read_uint32(const uint8_t *octets)
+{
+  return ((uint32_t)octets[0] << 24) | ((uint32_t)octets[1] << 16) |
+         ((uint32_t)octets[2] <<  8) |  (uint32_t)octets[3];
+}
+
+static size_t read_name(zone_name_buffer_t *name, const uint8_t *octets)
+{
+  size_t length = 0;
+  while (octets[length])
+    length += octets[length] + 1;
+  length++;
+  memcpy(name->octets, octets, length);
+  name->length = length;
+  return length;
+}
+
+nonnull_all
+static int32_t peek_soa(parser_t *parser, zone_soa_t *soa)
+{
+  int32_t code;
+  zone_rr_t rr;
+
+  if ((code = zone_next(parser, &rr)) < 0)
+    return code;
+  if (code == 0) {
+    zone_error(parser, "No SOA record");
+    return ZONE_SEMANTIC_ERROR;
+  }
+
+  assert(rr.type == ZONE_TYPE_SOA);
+  memcpy(soa->owner.octets, rr.owner.octets, rr.owner.length);
+  soa->owner.length = rr.owner.length;
+  soa->class = rr.class;
+  soa->ttl = rr.ttl;
+  // RDATA is verified by the parser
+  const uint8_t *octets = rr.rdata;
+  octets += read_name(&soa->primary, octets);
+  octets += read_name(&soa->mailbox, octets);
+  assert(octets + 20 == rr.rdata + rr.rdlength);
+  soa->serial = read_uint32(octets);
+  soa->refresh = read_uint32(octets + 4);
+  soa->retry = read_uint32(octets + 8);
+  soa->expire = read_uint32(octets + 12);
+  soa->minimum = read_uint32(octets + 16);
+  return 0;
+}
+
+int32_t zone_peek_soa(
+  parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const char *path,
+  zone_soa_t *soa)
+{
+  int32_t code;
+  zone_options_t peek = *options;
+
+  prepare_peek(&peek);
+  if ((code = zone_open(parser, &peek, buffers, path, NULL)) < 0)
+    return code;
+  code = peek_soa(parser, soa);
+  zone_close(parser);
+  return code;
+}
+
+int32_t zone_peek_soa_string(
+  parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const char *string,
+  size_t length,
+  zone_soa_t *soa)
+{
+  int32_t code;
+  zone_options_t peek = *options;
+
+  prepare_peek(&peek);
+  if ((code = initialize_parser(parser, &peek, buffers, NULL)) < 0)
+    return code;
+  parser->kernel = select_parse(parser);
+  if ((code = open_string(parser, string, length)) < 0)
+    return code;
+  code = peek_soa(parser, soa);
+  zone_close(parser);
+  return code;
+}
+
+zone_parser_t *zone_parser_create(void)
+{
+  parser_t *parser;
+
+  // window and tapes are allocated on first use
+  if (!(parser = calloc(1, sizeof(*parser))))
+    return NULL;
+  parser->cache.retain = true;
+  parser->kernel = select_kernel()->parse;
+  use_default_allocator(&parser->options);
+  return parser;
+}
+
+nonnull_all
+static bool is_same_allocator(
+  const zone_options_t *current, const zone_options_t *options)
+{
+  if (!options->allocator.allocate)
+    return current->allocator.allocate == &default_malloc;
+  return current->allocator.allocate == options->allocator.allocate &&
+         current->allocator.reallocate == options->allocator.reallocate &&
+         current->allocator.release == options->allocator.release &&
+         current->allocator.context == options->allocator.context;
+}
+
+int32_t zone_parser_reset(
+  parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  void *user_data)
+{
+  int32_t code;
+
+  // window and tapes are released by the allocator that provided them
+  if (!is_same_allocator(&parser->options, options)) {
+    zone_free(parser, parser->cache.window.data);
+    zone_free(parser, parser->cache.tapes);
+    parser->cache.window.data = NULL;
+    parser->cache.window.size = 0;
+    parser->cache.tapes = NULL;
+  }
+
+  // kernel is retained unless generated in template mode
+  zone_kernel_t kernel = parser->kernel;
+  if (parser->options.kernel)
+    kernel = select_kernel()->parse;
+  char *window = parser->cache.window.data;
+  const size_t size = parser->cache.window.size;
+  zone_tapes_t *tapes = parser->cache.tapes;
+
+  assert(kernel && parser->cache.retain);
+  // parsing a zone requires a successful reset
+  parser->file = NULL;
+  if ((code = initialize_parser(parser, options, buffers, user_data)) < 0)
+    return code;
+  parser->kernel = options->kernel ? options->kernel : kernel;
+  parser->cache.retain = true;
+  parser->cache.window.data = window;
+  parser->cache.window.size = size;
+  parser->cache.tapes = tapes;
+  return 0;
+}
+
+int32_t zone_parser_parse(parser_t *parser, const char *path)
+{
+  int32_t code;
+
+  if (!parser->file)
     return ZONE_BAD_PARAMETER;
-  initialize_file(parser, parser->file);
-  parser->file->buffer.data = (char *)string;
-  parser->file->buffer.size = length;
-  parser->file->buffer.length = length;
-  parser->file->fields.tape[0] = &string[length];
-  parser->file->fields.tape[1] = &string[length];
-  assert(parser->file->end_of_file == 1);
+  if ((code = open_zone(parser, path)) == 0)
+    code = parse(parser, parser->user_data);
+  zone_close(parser);
+  parser->file = NULL;
+  return code;
+}
+
+int32_t zone_parser_parse_string(
+  parser_t *parser, const char *string, size_t length)
+{
+  int32_t code;
+
+  if (!parser->file)
+    return ZONE_BAD_PARAMETER;
+  if ((code = open_string(parser, string, length)) == 0)
+    code = parse(parser, parser->user_data);
+  zone_close(parser);
+  parser->file = NULL;
+  return code;
+}
+
+// input is copied to the window of the parser so that it need not be null
+// terminated and padded, state is reset for every record
+nonnull((1,2))
+static int32_t open_record(
+  parser_t *parser,
+  const char *string,
+  size_t length,
+  const zone_name_t *origin,
+  uint32_t default_ttl)
+{
+  file_t *file = &parser->first;
+
+  if (parser->cache.window.size < length) {
+    const size_t size = length < ZONE_WINDOW_SIZE ? ZONE_WINDOW_SIZE : length;
+    zone_free(parser, parser->cache.window.data);
+    parser->cache.window.size = 0;
+    if (!(parser->cache.window.data = zone_malloc(parser, size + 1 + ZONE_BLOCK_SIZE)))
+      return ZONE_OUT_OF_MEMORY;
+    parser->cache.window.size = size;
+  }
+
+  initialize_file(parser, file);
+  if (origin) {
+    memcpy(file->origin.octets, origin->octets, origin->length);
+    file->origin.length = origin->length;
+  }
+  file->dollar_ttl = file->last_ttl = default_ttl;
+  file->buffer.data = parser->cache.window.data;
+  file->buffer.size = length;
+  file->buffer.length = length;
+  memcpy(file->buffer.data, string, length);
+  memset(file->buffer.data + length, 0, 1 + ZONE_BLOCK_SIZE);
+
+  parser->owner = &parser->buffers.owner.blocks[0];
+  parser->owner->length = 0;
+  parser->rdata = &parser->buffers.rdata.blocks[0];
+  parser->owner_stated = false;
+  parser->out_of_scope = false;
+  parser->skip.code = 0;
+
+  size_t size = ((length + ZONE_BLOCK_SIZE - 1) / ZONE_BLOCK_SIZE + 1) *
+                ZONE_BLOCK_SIZE;
+  if (size > ZONE_TAPE_SIZE)
+    size = ZONE_TAPE_SIZE;
+  return open_tapes(parser, size);
+}
 
+int32_t zone_parse_rr(
+  parser_t *parser,
+  const char *string,
+  size_t length,
+  const zone_name_t *origin,
+  uint32_t default_ttl,
+  zone_rr_t *rr)
+{
+  int32_t code;
+  const bool no_includes = parser->options.no_includes;
+  const uint64_t interval = parser->options.checkpoint.interval;
+
+  if (!parser->file || parser->custom_delivery || parser->options.lazy.callback)
+    return ZONE_BAD_PARAMETER;
+  if (!length || (origin && !is_origin(origin->octets, origin->length)))
+    return ZONE_BAD_PARAMETER;
+  if (!parser->options.secondary && default_ttl > INT32_MAX)
+    return ZONE_BAD_PARAMETER;
+  if ((code = open_record(parser, string, length, origin, default_ttl)) < 0)
+    return code;
+
+  // records do not come from files, includes and checkpoints are disabled
+  parser->options.no_includes = true;
+  parser->options.checkpoint.interval = 0;
+  parser->rr = rr;
+  parser->custom_delivery = true;
+  if ((code = parser->kernel(parser)) == 1) {
+    // the input must not hold more than one record
+    zone_rr_t next;
+    parser->rr = &next;
+    if ((code = parser->kernel(parser)) == 1) {
+      zone_error(parser, "More than one record");
+      code = ZONE_SYNTAX_ERROR;
+    }
+  } else if (code == 0) {
+    zone_error(parser, "Missing record");
+    code = ZONE_SYNTAX_ERROR;
+  }
+  parser->custom_delivery = false;
+  parser->rr = NULL;
+  parser->options.no_includes = no_includes;
+  parser->options.checkpoint.interval = interval;
+  return code;
+}
+
+void zone_parser_destroy(parser_t *parser)
+{
+  if (!parser)
+    return;
+  zone_free(parser, parser->cache.window.data);
+  zone_free(parser, parser->cache.tapes);
+  free(parser);
+}
+
+diagnostic_push()
+clang_diagnostic_ignored(missing-prototypes)
+
+int32_t zone_flush(parser_t *parser)
+{
+  int32_t code = 0;
+
+  if (parser->rrset) {
+    // rdata buffers are used round-robin, the active buffer is not in use
+    if (parser->rrset->count)
+      code = parser->options.rrset.callback(
+        parser, parser->rrset, parser->user_data);
+    parser->rrset->count = 0;
+    return code;
+  }
+
+  assert(parser->batch);
+  if (parser->batch->count)
+    code = parser->options.batch.callback(
+      parser, parser->batch, parser->user_data);
+  parser->batch->count = 0;
+  parser->buffers.rdata.active = 0;
+  parser->rdata = &parser->buffers.rdata.blocks[0];
+  return code;
+}
+
+// reserve space for the next RR, RDATA is decoded directly into the arena
+int32_t zone_reserve(parser_t *parser)
+{
+  zone_arena_t *arena = parser->options.arena.arena;
+  const size_t reserve = ZONE_ARENA_RESERVE;
+  int32_t code;
+
+  // offsets of owners are limited to 32 bits
+  if (arena->size - arena->length < reserve ||
+      arena->length > UINT32_MAX - reserve)
+  {
+    const size_t length = arena->length;
+    if (!parser->options.arena.callback)
+      return ZONE_OUT_OF_MEMORY;
+    code = parser->options.arena.callback(
+      parser, arena, reserve, parser->user_data);
+    if (code < 0)
+      return code;
+    if (((uintptr_t)arena->octets & 3) || (arena->length & 3) ||
+        arena->length > arena->size ||
+        arena->size - arena->length < reserve ||
+        arena->length > UINT32_MAX - reserve)
+      return ZONE_OUT_OF_MEMORY;
+    // owner is stored again unless the arena was resized
+    if (arena->length != length)
+      parser->packed_owner = SIZE_MAX;
+  }
+
+  parser->rdata = (zone_rdata_buffer_t *)(void *)
+    (arena->octets + arena->length + offsetof(zone_packed_rr_t, rdata));
+  return 0;
+}
+
+int32_t zone_checkpoint(parser_t *parser, uint64_t offset)
+{
+  size_t depth = 0;
+  int32_t code;
+  zone_checkpoint_file_t *files;
+
+  // RRs preceding the checkpoint are delivered before it is taken
+  if ((parser->batch || parser->rrset) && (code = zone_flush(parser)) < 0)
+    return code;
+
+  for (const file_t *file = parser->file; file; file = file->includer)
+    depth++;
+  if (!(files = zone_malloc(parser, depth * sizeof(*files))))
+    return ZONE_OUT_OF_MEMORY;
+
+  size_t level = depth;
+  for (const file_t *file = parser->file; file; file = file->includer) {
+    const bool active = file == parser->file;
+    const zone_name_buffer_t *owner = active ? parser->owner : &file->owner;
+
+    // resume offset of includer is unknown, skip checkpoint
+    if (!active && file->checkpoint.resume == UINT64_MAX)
+      return zone_free(parser, files), 0;
+
+    level--;
+    files[level].path = file->path;
+    files[level].offset = active ? offset : file->checkpoint.resume;
+    files[level].line = file->line;
+    files[level].origin.length = (uint8_t)file->origin.length;
+    files[level].origin.octets = file->origin.octets;
+    files[level].owner.length = (uint8_t)owner->length;
+    files[level].owner.octets = owner->octets;
+    files[level].last_class = file->last_class;
+    files[level].last_ttl = file->last_ttl;
+    files[level].dollar_ttl = file->dollar_ttl;
+    files[level].has_dollar_ttl = file->default_ttl == &file->dollar_ttl;
+  }
+
+  assert(level == 0);
+  code = parser->options.checkpoint.callback(
+    parser, &(zone_checkpoint_t){ depth, files }, parser->user_data);
+  zone_free(parser, files);
+  return code;
+}
+
+diagnostic_pop()
+
+nonnull_all
+static int32_t seek_file(file_t *file, uint64_t offset)
+{
+#if _WIN32
+  if (offset > INT64_MAX || _fseeki64(file->handle, (__int64)offset, SEEK_SET))
+    return ZONE_READ_ERROR;
+#else
+  if (offset > (uint64_t)((off_t)-1 >> 1) ||
+      fseeko(file->handle, (off_t)offset, SEEK_SET))
+    return ZONE_READ_ERROR;
+#endif
+  file->buffer.offset = offset;
+  file->checkpoint.last = offset;
+  // checkpoints are taken at the start of a line, but the first line may
+  // or may not specify an owner
+  const int c = getc(file->handle);
+  if (c == EOF)
+    return ferror(file->handle) ? ZONE_READ_ERROR : 0;
+  file->start_of_line = !(c == ' ' || c == '\t' || c == '\r');
+  return ungetc(c, file->handle) == c ? 0 : ZONE_READ_ERROR;
+}
+
+nonnull_all
+static int32_t restore_file(
+  file_t *file, const zone_checkpoint_file_t *state)
+{
+  if (!state->origin.octets || !state->origin.length)
+    return ZONE_BAD_PARAMETER;
+  if (state->owner.length && !state->owner.octets)
+    return ZONE_BAD_PARAMETER;
+
+  memcpy(file->origin.octets, state->origin.octets, state->origin.length);
+  file->origin.length = state->origin.length;
+  if (state->owner.length)
+    memcpy(file->owner.octets, state->owner.octets, state->owner.length);
+  file->owner.length = state->owner.length;
+  file->line = state->line ? state->line : 1;
+  file->last_class = state->last_class;
+  file->last_ttl = state->last_ttl;
+  file->dollar_ttl = state->dollar_ttl;
+  if (state->has_dollar_ttl)
+    file->ttl = file->default_ttl = &file->dollar_ttl;
+  else
+    file->ttl = file->default_ttl = &file->last_ttl;
+  return seek_file(file, state->offset);
+}
+
+int32_t zone_resume(
+  parser_t *parser,
+  const zone_options_t *options,
+  zone_buffers_t *buffers,
+  const zone_checkpoint_t *checkpoint,
+  void *user_data)
+{
+  int32_t code;
+
+  if ((code = initialize_parser(parser, options, buffers, user_data)) < 0)
+    return code;
+  parser->kernel = select_parse(parser);
+  if (!checkpoint->depth || !checkpoint->files)
+    return ZONE_BAD_PARAMETER;
+  if (checkpoint->depth > (size_t)parser->options.include_limit + 1)
+    return ZONE_BAD_PARAMETER;
+
+  for (size_t level=0; level < checkpoint->depth; level++) {
+    const zone_checkpoint_file_t *state = &checkpoint->files[level];
+    file_t *file;
+
+    // standard input cannot be repositioned
+    if (!state->path || strcmp(state->path, "-") == 0)
+      code = ZONE_BAD_PARAMETER;
+    else if (level == 0)
+      code = open_file(parser, (file = &parser->first), state->path, strlen(state->path));
+    else
+      code = zone_open_file(parser, state->path, strlen(state->path), &file);
+
+    if (code < 0) {
+      if (level != 0)
+        zone_close(parser);
+      return code;
+    }
+
+    // includers are repositioned and need not be rescanned, tapes are shared
+    if (level != 0) {
+      file->includer = parser->file;
+      attach_tapes(file, parser->file->tapes);
+      parser->file = file;
+    }
+
+    if ((code = restore_file(file, state)) < 0) {
+      zone_error(parser, "Cannot resume %s", state->path);
+      zone_close(parser);
+      return code;
+    }
+  }
+
+  parser->owner = &parser->file->owner;
+  parser->owner_stated = true;
+  if (parser->hash_owners)
+    parser->owner_hash =
+      hash_name(parser->owner->octets, parser->owner->length);
+  if (parser->options.owner_labels)
+    index_labels(&parser->labels, parser->owner->octets, parser->owner->length);
+  update_scope(parser, parser->owner->octets, parser->owner->length);
   code = parse(parser, user_data);
   zone_close(parser);
   return code;
@@ -481,9 +1441,12 @@ static void print_message(
     fprintf(output, "%s\n", message);
 }
 
-void zone_vlog(
+void zone_vdiagnose(
   zone_parser_t *parser,
   uint32_t priority,
+  int32_t code,
+  const char *field,
+  const char *type,
   const char *format,
   va_list arguments);
 
@@ -491,6 +1454,27 @@ void zone_vlog(
   zone_parser_t *parser,
   uint32_t priority,
   const char *format,
+  va_list arguments);
+
+// offset of the last token read, if tapes are attached
+nonnull_all
+static uint64_t diagnostic_offset(const file_t *file)
+{
+  if (!file->tapes || file->fields.head <= file->fields.tape)
+    return file->buffer.offset + file->buffer.index;
+  const char *data = file->buffer.data, *field = file->fields.head[-1];
+  if (field < data || field > data + file->buffer.length)
+    return file->buffer.offset + file->buffer.index;
+  return file->buffer.offset + (uint64_t)(field - data);
+}
+
+void zone_vdiagnose(
+  zone_parser_t *parser,
+  uint32_t priority,
+  int32_t code,
+  const char *field,
+  const char *type,
+  const char *format,
   va_list arguments)
 {
   char message[2048];
@@ -500,18 +1484,58 @@ void zone_vlog(
   if (!(priority & ~parser->options.log.mask))
     return;
 
+  assert(parser->file);
+  // structured diagnostics are formatted on request
+  if (parser->options.log.diagnose) {
+    va_list copy;
+    zone_diagnostic_t diagnostic;
+    diagnostic.priority = priority;
+    diagnostic.code = code;
+    diagnostic.field = field;
+    diagnostic.type = type;
+    diagnostic.file = parser->file->name;
+    diagnostic.line = parser->file->line;
+    diagnostic.offset = diagnostic_offset(parser->file);
+    diagnostic.format = format;
+    va_copy(copy, arguments);
+    diagnostic.arguments = &copy;
+    parser->options.log.diagnose(parser, &diagnostic, parser->user_data);
+    va_end(copy);
+    return;
+  }
+
   length = vsnprintf(message, sizeof(message), format, arguments);
   assert(length >= 0);
   if ((size_t)length >= sizeof(message))
     memcpy(message+(sizeof(message) - 4), "...", 3);
   if (parser->options.log.callback)
     callback = parser->options.log.callback;
-  assert(parser->file);
   const char *file = parser->file->name;
   const size_t line = parser->file->line;
   callback(parser, priority, file, line, message, parser->user_data);
 }
 
+void zone_vlog(
+  zone_parser_t *parser,
+  uint32_t priority,
+  const char *format,
+  va_list arguments)
+{
+  zone_vdiagnose(parser, priority, 0, NULL, NULL, format, arguments);
+}
+
+int zone_format_diagnostic(
+  const zone_diagnostic_t *diagnostic, char *buffer, size_t size)
+{
+  va_list arguments;
+  int length;
+
+  va_copy(arguments, *(va_list *)diagnostic->arguments);
+  length = vsnprintf(buffer, size, diagnostic->format, arguments);
+  va_end(arguments);
+  return length;
+}
+
 void zone_log(
   zone_parser_t *parser,
   uint32_t priority,
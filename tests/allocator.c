@@ -0,0 +1,183 @@
+/*
+ * allocator.c -- test allocator callbacks
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+typedef struct counter counter_t;
+struct counter {
+  size_t allocations;
+  size_t live;
+};
+
+// blocks are tagged to verify memory is released by the allocator that
+// provided it
+static const uint64_t tag = 0x7a6f6e65616c6c6full;
+
+static void *count_allocate(void *context, size_t size)
+{
+  counter_t *counter = context;
+  uint64_t *block = malloc(sizeof(uint64_t) * 2 + size);
+  if (!block)
+    return NULL;
+  block[0] = tag;
+  counter->allocations++;
+  counter->live++;
+  return block + 2;
+}
+
+static void *count_reallocate(void *context, void *pointer, size_t size)
+{
+  counter_t *counter = context;
+  uint64_t *block = pointer ? (uint64_t *)pointer - 2 : NULL;
+  assert_true(!block || block[0] == tag);
+  if (!(block = realloc(block, sizeof(uint64_t) * 2 + size)))
+    return NULL;
+  if (!pointer) {
+    counter->allocations++;
+    counter->live++;
+  }
+  block[0] = tag;
+  return block + 2;
+}
+
+static void count_release(void *context, void *pointer)
+{
+  counter_t *counter = context;
+  uint64_t *block = (uint64_t *)pointer - 2;
+  assert_non_null(pointer);
+  assert_true(block[0] == tag);
+  block[0] = 0;
+  counter->live--;
+  free(block);
+}
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  (void)parser;
+  (void)owner;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  (*(size_t *)user_data)++;
+  return 0;
+}
+
+static void initialize_options(zone_options_t *options, counter_t *counter)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+
+  memset(options, 0, sizeof(*options));
+  options->accept.callback = &accept_rr;
+  options->origin.octets = origin;
+  options->origin.length = sizeof(origin);
+  options->default_ttl = 3600;
+  options->default_class = ZONE_CLASS_IN;
+  if (!counter)
+    return;
+  options->allocator.allocate = &count_allocate;
+  options->allocator.reallocate = &count_reallocate;
+  options->allocator.release = &count_release;
+  options->allocator.context = counter;
+}
+
+/*!cmocka */
+void allocate_with_callbacks(void **state)
+{
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  counter_t counter = { 0, 0 };
+  char *include, *includer, text[512];
+  size_t count = 0;
+
+  (void)state;
+
+  include = write_file("bar A 192.0.2.2\n");
+  assert_non_null(include);
+  (void)snprintf(text, sizeof(text), "foo A 192.0.2.1\n$INCLUDE \"%s\"\n", include);
+  includer = write_file(text);
+  assert_non_null(includer);
+
+  // paths, windows, tapes and included files are allocated
+  initialize_options(&options, &counter);
+  assert_int_equal(zone_parse(&parser, &options, &buffers, includer, &count), ZONE_SUCCESS);
+  assert_int_equal(count, 2);
+  assert_true(counter.allocations >= 6);
+  assert_int_equal(counter.live, 0);
+
+  // either all or none of the callbacks must be set
+  options.allocator.reallocate = NULL;
+  assert_int_equal(
+    zone_parse(&parser, &options, &buffers, includer, &count), ZONE_BAD_PARAMETER);
+
+  remove(includer);
+  remove(include);
+  free(includer);
+  free(include);
+}
+
+/*!cmocka */
+void switch_allocators(void **state)
+{
+  zone_parser_t *parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  counter_t counter = { 0, 0 };
+  static const char text[] = "foo A 192.0.2.1\n";
+  char input[sizeof(text) + ZONE_BLOCK_SIZE] = { 0 };
+  size_t count = 0;
+
+  (void)state;
+
+  memcpy(input, text, sizeof(text) - 1);
+  parser = zone_parser_create();
+  assert_non_null(parser);
+
+  // tapes are retained by reusable parsers
+  initialize_options(&options, &counter);
+  assert_int_equal(zone_parser_reset(parser, &options, &buffers, &count), 0);
+  assert_int_equal(zone_parser_parse_string(parser, input, sizeof(text) - 1), 0);
+  assert_int_equal(count, 1);
+  assert_int_equal(counter.live, 1);
+
+  // and released by the allocator that provided them
+  initialize_options(&options, NULL);
+  assert_int_equal(zone_parser_reset(parser, &options, &buffers, &count), 0);
+  assert_int_equal(counter.live, 0);
+  assert_int_equal(zone_parser_parse_string(parser, input, sizeof(text) - 1), 0);
+  assert_int_equal(count, 2);
+
+  initialize_options(&options, &counter);
+  assert_int_equal(zone_parser_reset(parser, &options, &buffers, &count), 0);
+  assert_int_equal(zone_parser_parse_string(parser, input, sizeof(text) - 1), 0);
+  assert_int_equal(counter.live, 1);
+  zone_parser_destroy(parser);
+  assert_int_equal(counter.live, 0);
+}
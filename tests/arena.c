@@ -0,0 +1,211 @@
+/*
+ * arena.c -- test packing RRs into an arena
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+#define MAX_RECORDS (4096)
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count, owners;
+  uint64_t records[MAX_RECORDS];
+  uint8_t *memory;
+  size_t grown;
+  bool resize;
+};
+
+static int32_t record_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  if (recording->count == MAX_RECORDS)
+    return ZONE_OUT_OF_MEMORY;
+  recording->records[recording->count++] =
+    fingerprint(owner, type, class, ttl, rdlength, rdata);
+  return 0;
+}
+
+// walk RRs in arena, owners follow the RDATA of the first RR referencing them
+static void unpack(recording_t *recording, const zone_arena_t *arena)
+{
+  size_t offset = 0;
+
+  for (size_t i=0; i < arena->count; i++) {
+    const zone_packed_rr_t *rr = (const void *)(arena->octets + offset);
+    size_t next = offset + offsetof(zone_packed_rr_t, rdata) + rr->rdlength;
+    assert_true(rr->owner < arena->length);
+    if (rr->owner == next) {
+      next += 1 + arena->octets[next];
+      recording->owners++;
+    }
+    assert_true(recording->count < MAX_RECORDS);
+    const uint8_t *owner = arena->octets + rr->owner;
+    recording->records[recording->count++] = fingerprint(
+      &(zone_name_t){ owner[0], owner + 1 }, rr->type, rr->class, rr->ttl,
+      rr->rdlength, rr->rdata);
+    offset = (next + 3) & ~(size_t)3;
+  }
+
+  assert_int_equal(offset, arena->length);
+}
+
+static int32_t grow_arena(
+  zone_parser_t *parser, zone_arena_t *arena, size_t size, void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+
+  recording->grown++;
+  if (recording->resize) {
+    uint8_t *memory = realloc(recording->memory, arena->size + size);
+    if (!memory)
+      return ZONE_OUT_OF_MEMORY;
+    recording->memory = memory;
+    arena->octets = memory;
+    arena->size += size;
+  } else {
+    unpack(recording, arena);
+    arena->length = 0;
+    arena->count = 0;
+  }
+  return 0;
+}
+
+static char *generate(size_t records)
+{
+  size_t length = 0, size = records * 64;
+  char *text = malloc(size + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(text);
+  for (size_t i=0; i < records; i++) {
+    if (i % 3 == 0)
+      length += (size_t)snprintf(text + length, size - length,
+        "host%zu 300 A 192.0.2.%zu\n", i / 3, i % 256);
+    else if (i % 3 == 1)
+      length += (size_t)snprintf(text + length, size - length,
+        "  TXT \"record %zu\"\n", i);
+    else
+      length += (size_t)snprintf(text + length, size - length,
+        "HOST%zu AAAA 2001:db8::%zx\n", i / 3, i);
+  }
+  memset(text + length, 0, 1 + ZONE_BLOCK_SIZE);
+  return text;
+}
+
+static int32_t parse(
+  const char *text, zone_arena_t *arena, zone_grow_arena_t grow,
+  recording_t *recording)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+
+  memset(&options, 0, sizeof(options));
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+  if (arena) {
+    options.arena.arena = arena;
+    options.arena.callback = grow;
+  } else {
+    options.accept.callback = &record_rr;
+  }
+
+  return zone_parse_string(
+    &parser, &options, &buffers, text, strlen(text), recording);
+}
+
+/*!cmocka */
+void pack_into_arena(void **state)
+{
+  recording_t *reference, *packed;
+  zone_arena_t arena;
+  char *text;
+
+  (void)state;
+
+  reference = calloc(1, sizeof(*reference));
+  packed = calloc(1, sizeof(*packed));
+  assert_non_null(reference);
+  assert_non_null(packed);
+
+  text = generate(3000);
+  assert_int_equal(parse(text, NULL, 0, reference), ZONE_SUCCESS);
+  assert_int_equal(reference->count, 3000);
+
+  // single arena, owners are stored once for every stated owner that differs
+  packed->memory = malloc(1024 * 1024);
+  assert_non_null(packed->memory);
+  arena = (zone_arena_t){ packed->memory, 1024 * 1024, 0, 0 };
+  assert_int_equal(parse(text, &arena, 0, packed), ZONE_SUCCESS);
+  assert_int_equal(arena.count, 3000);
+  unpack(packed, &arena);
+  assert_int_equal(packed->owners, 2000);
+  assert_int_equal(packed->count, reference->count);
+  assert_memory_equal(
+    packed->records, reference->records, 3000 * sizeof(uint64_t));
+
+  // arena is full, no callback
+  arena = (zone_arena_t){ packed->memory, ZONE_ARENA_RESERVE + 64, 0, 0 };
+  assert_int_equal(parse(text, &arena, 0, packed), ZONE_OUT_OF_MEMORY);
+  assert_true(arena.count > 0 && arena.count < 8);
+
+  // arena is consumed and reset by callback
+  memset(packed->records, 0, sizeof(packed->records));
+  packed->count = 0;
+  packed->owners = 0;
+  arena = (zone_arena_t){ packed->memory, 2 * ZONE_ARENA_RESERVE, 0, 0 };
+  assert_int_equal(parse(text, &arena, &grow_arena, packed), ZONE_SUCCESS);
+  unpack(packed, &arena);
+  assert_true(packed->grown > 0);
+  assert_int_equal(packed->count, reference->count);
+  assert_memory_equal(
+    packed->records, reference->records, 3000 * sizeof(uint64_t));
+
+  // arena is resized by callback, owners remain shared
+  packed->count = 0;
+  packed->owners = 0;
+  packed->grown = 0;
+  packed->resize = true;
+  arena = (zone_arena_t){ packed->memory, ZONE_ARENA_RESERVE, 0, 0 };
+  assert_int_equal(parse(text, &arena, &grow_arena, packed), ZONE_SUCCESS);
+  assert_true(packed->grown > 0);
+  unpack(packed, &arena);
+  assert_int_equal(packed->owners, 2000);
+  assert_memory_equal(
+    packed->records, reference->records, 3000 * sizeof(uint64_t));
+
+  // arena must be aligned
+  arena = (zone_arena_t){ packed->memory + 1, ZONE_ARENA_RESERVE, 0, 0 };
+  assert_int_equal(parse(text, &arena, 0, packed), ZONE_BAD_PARAMETER);
+
+  free(packed->memory);
+  free(text);
+  free(reference);
+  free(packed);
+}
@@ -0,0 +1,114 @@
+/*
+ * base16.c -- test base16 support
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+static int32_t add_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  (void)parser;
+  (void)owner;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdata;
+  *(uint16_t *)user_data = rdlength;
+  return ZONE_SUCCESS;
+}
+
+static uint8_t origin[] =
+  { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 3, 'c', 'o', 'm', 0 };
+
+static const uint8_t digest[] = {
+  0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+  0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+  0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78,
+  0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1, 0xf0,
+  0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+  0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+  0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78,
+  0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1, 0xf0
+};
+
+/*!cmocka */
+void base16_syntax(void **state)
+{
+  // digests are long enough to be decoded in blocks of 32 digits, an
+  // unassigned digest type is used to allow for digests of any length
+  static const struct {
+    int32_t result;
+    const char *base16;
+    size_t length;
+  } tests[] = {
+    // lower case
+    { ZONE_SUCCESS, "0123456789abcdeffedcba98765432100f1e2d3c4b5a69788796a5b4c3d2e1f0"
+                    "0123456789abcdeffedcba98765432100f1e2d3c4b5a69788796a5b4c3d2e1f0", 64 },
+    // upper case
+    { ZONE_SUCCESS, "0123456789ABCDEFFEDCBA98765432100F1E2D3C4B5A69788796A5B4C3D2E1F0", 32 },
+    // mixed case, split over words of uneven length
+    { ZONE_SUCCESS, "0123456789aBcDeFfEdCbA98765432100 f1e2d3c4b5a69788796a5b4c3d2e1f"
+                    "0 0123456789abcdeffedcba98765432100f1e2d3c4b5a69788796a5b4c3d2e1f0", 64 },
+    // bad character in first block
+    { ZONE_SYNTAX_ERROR, "01234g6789abcdeffedcba98765432100f1e2d3c4b5a69788796a5b4c3d2e1f0", 0 },
+    //                         ^ (not a hexadecimal digit)
+    // bad character in second block
+    { ZONE_SYNTAX_ERROR, "0123456789abcdeffedcba98765432100f1e2d3c4b5a6978:796a5b4c3d2e1f0", 0 },
+    //                                                          ^ (not a hexadecimal digit)
+    // bad characters adjacent to ranges of hexadecimal digits
+    { ZONE_SYNTAX_ERROR, "/123456789abcdeffedcba98765432100f1e2d3c4b5a69788796a5b4c3d2e1f0", 0 },
+    { ZONE_SYNTAX_ERROR, "0123456789abcdef@edcba98765432100f1e2d3c4b5a69788796a5b4c3d2e1f0", 0 },
+    { ZONE_SYNTAX_ERROR, "0123456789abcdeffedcba98765432100f1e2d3c4b5a69788796a5b4c3d2e1fG", 0 },
+    { ZONE_SYNTAX_ERROR, "0123456789abcdeffedcba9876543210`f1e2d3c4b5a69788796a5b4c3d2e1f0", 0 },
+  };
+
+  (void)state;
+
+  for (size_t i=0, n=sizeof(tests)/sizeof(tests[0]); i < n; i++) {
+    char rr[512];
+    const char rrfmt[] = "foo. DS 60485 5 99 ( %s )";
+    zone_parser_t parser;
+    zone_name_buffer_t name;
+    zone_rdata_buffer_t rdata;
+    zone_buffers_t buffers = { 1, &name, &rdata };
+    zone_options_t options;
+    uint16_t rdlength = 0;
+    int32_t result;
+
+    memset(rr, 0, sizeof(rr));
+    (void)snprintf(rr, sizeof(rr), rrfmt, tests[i].base16);
+
+    fprintf(stderr, "INPUT: '%s'\n", rr);
+
+    memset(&options, 0, sizeof(options));
+    options.accept.callback = add_rr;
+    options.origin.octets = origin;
+    options.origin.length = sizeof(origin);
+    options.default_ttl = 3600;
+    options.default_class = ZONE_CLASS_IN;
+
+    result = zone_parse_string(&parser, &options, &buffers, rr, strlen(rr), &rdlength);
+    assert_int_equal(result, tests[i].result);
+    if (tests[i].result != ZONE_SUCCESS)
+      continue;
+    assert_int_equal(rdlength, 4 + tests[i].length);
+    assert_memory_equal(rdata.octets+4, digest, tests[i].length);
+  }
+}
@@ -0,0 +1,236 @@
+/*
+ * batch.c -- test delivery of RRs in batches
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+#define RECORDS (1000)
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  size_t batches;
+  size_t limit;
+  size_t shared_owners;
+  int32_t code;
+  uint64_t records[RECORDS];
+};
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  if (recording->count == RECORDS)
+    return ZONE_OUT_OF_MEMORY;
+  recording->records[recording->count++] =
+    fingerprint(owner, type, class, ttl, rdlength, rdata);
+  return 0;
+}
+
+static int32_t accept_batch(
+  zone_parser_t *parser,
+  const zone_batch_t *batch,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  if (!batch->count || batch->count > recording->limit)
+    return ZONE_SEMANTIC_ERROR;
+  if (RECORDS - recording->count < batch->count)
+    return ZONE_OUT_OF_MEMORY;
+  recording->batches++;
+  // fingerprints are computed after the batch is complete to verify that
+  // owners and rdata remain valid for every RR in the batch
+  for (size_t i=0; i < batch->count; i++) {
+    if (i && batch->owners[i].octets == batch->owners[i-1].octets)
+      recording->shared_owners++;
+    recording->records[recording->count++] = fingerprint(
+      &batch->owners[i], batch->types[i], batch->classes[i], batch->ttls[i],
+      batch->rdlengths[i], batch->rdata[i]);
+  }
+  return recording->code;
+}
+
+static int32_t parse_with_code(
+  const char *text,
+  size_t size,
+  bool batch,
+  int32_t callback_code,
+  recording_t *recording)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_buffers_t buffers;
+  zone_options_t options;
+  int32_t code;
+
+  buffers.size = size;
+  buffers.owner = calloc(size, sizeof(*buffers.owner));
+  buffers.rdata = calloc(size, sizeof(*buffers.rdata));
+  assert_non_null(buffers.owner);
+  assert_non_null(buffers.rdata);
+
+  memset(&options, 0, sizeof(options));
+  if (batch)
+    options.batch.callback = &accept_batch;
+  else
+    options.accept.callback = &accept_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  memset(recording, 0, sizeof(*recording));
+  recording->limit = size < ZONE_BATCH_SIZE ? size : ZONE_BATCH_SIZE;
+  recording->code = callback_code;
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, recording);
+  free(input);
+  free(buffers.owner);
+  free(buffers.rdata);
+  return code;
+}
+
+static int32_t parse(
+  const char *text, size_t size, bool batch, recording_t *recording)
+{
+  return parse_with_code(text, size, batch, 0, recording);
+}
+
+/*!cmocka */
+void batches_match_records(void **state)
+{
+  static const char record_fmt[] =
+    "host%d A 192.0.2.%d\n"
+    "  TXT \"host %d\"\n";
+  char *text;
+  size_t length = 0, size = RECORDS * 32;
+  recording_t *expected, *batched;
+
+  (void)state;
+
+  text = malloc(size);
+  expected = malloc(sizeof(*expected));
+  batched = malloc(sizeof(*batched));
+  assert_non_null(text);
+  assert_non_null(expected);
+  assert_non_null(batched);
+
+  for (int i=0; i < RECORDS / 2; i++)
+    length += (size_t)snprintf(
+      text + length, size - length, record_fmt, i, i % 256, i);
+
+  assert_int_equal(parse(text, 1, false, expected), ZONE_SUCCESS);
+  assert_int_equal(expected->count, RECORDS);
+
+  static const size_t sizes[] = { 1, 3, 300 };
+  for (size_t i=0; i < sizeof(sizes)/sizeof(sizes[0]); i++) {
+    assert_int_equal(parse(text, sizes[i], true, batched), ZONE_SUCCESS);
+    assert_int_equal(batched->count, RECORDS);
+    assert_int_equal(batched->batches, (RECORDS + batched->limit - 1) / batched->limit);
+    assert_memory_equal(batched->records, expected->records, sizeof(expected->records));
+    if (sizes[i] > 1)
+      assert_true(batched->shared_owners > 0);
+  }
+
+  free(text);
+  free(expected);
+  free(batched);
+}
+
+static int32_t partition_rr(
+  zone_parser_t *parser,
+  size_t partition,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  (void)partition;
+  return accept_rr(parser, owner, type, class, ttl, rdlength, rdata, user_data);
+}
+
+/*!cmocka */
+void batch_excludes_partition(void **state)
+{
+  static const uint8_t origin[] = { 0 };
+  static const char text[] = "foo. A 192.0.2.1\n";
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  char input[sizeof(text) + ZONE_BLOCK_SIZE];
+  int32_t code;
+
+  (void)state;
+
+  memset(input, 0, sizeof(input));
+  memcpy(input, text, sizeof(text) - 1);
+  memset(&options, 0, sizeof(options));
+  options.batch.callback = &accept_batch;
+  options.partition.count = 4;
+  options.partition.callback = &partition_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  code = zone_parse_string(
+    &parser, &options, &buffers, input, sizeof(text) - 1, NULL);
+  assert_int_equal(code, ZONE_BAD_PARAMETER);
+}
+
+/*!cmocka */
+void positive_batch_continues(void **state)
+{
+  char text[512];
+  int length = 0;
+  recording_t *recording;
+
+  (void)state;
+
+  for (int i=0; i < 10; i++)
+    length += snprintf(
+      text + length, sizeof(text) - (size_t)length, "host%d A 192.0.2.%d\n", i, i);
+
+  recording = malloc(sizeof(*recording));
+  assert_non_null(recording);
+
+  // last batch is delivered at end of input, or when the batch is full
+  for (size_t size=4; size <= 5; size++) {
+    int32_t code = parse_with_code(text, size, true, 1, recording);
+    assert_int_equal(code, 1);
+    assert_int_equal(recording->count, 10);
+  }
+
+  free(recording);
+}
@@ -0,0 +1,135 @@
+/*
+ * canonical.c -- test conversion of names to canonical form
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  struct {
+    uint8_t owner[255];
+    size_t owner_length;
+    uint8_t rdata[512];
+    size_t rdlength;
+  } records[8];
+};
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  if (recording->count == 8 || rdlength > 512)
+    return ZONE_OUT_OF_MEMORY;
+  const size_t index = recording->count++;
+  memcpy(recording->records[index].owner, owner->octets, owner->length);
+  recording->records[index].owner_length = owner->length;
+  memcpy(recording->records[index].rdata, rdata, rdlength);
+  recording->records[index].rdlength = rdlength;
+  return 0;
+}
+
+static int32_t parse(const char *text, bool canonical, recording_t *recording)
+{
+  static const uint8_t origin[] = { 7, 'E', 'x', 'A', 'm', 'P', 'l', 'E', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.accept.callback = &accept_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+  options.canonical = canonical;
+
+  memset(recording, 0, sizeof(*recording));
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, recording);
+  free(input);
+  return code;
+}
+
+#define NAME(name) (const uint8_t *)(name), sizeof(name) - 1
+
+/*!cmocka */
+void canonical_names(void **state)
+{
+  static const char text[] =
+    "WWW A 192.0.2.1\n"
+    "\\065.Example.COM. NS NS1.EXAMPLE.COM.\n"
+    "@ MX 10 Mail\n"
+    "A-RATHER-LONG-LABEL-TO-SPAN-BLOCKS.Example.COM. CNAME "
+      "ANOTHER-RATHER-LONG-LABEL-TO-SPAN-BLOCKS.Example.COM.\n"
+    "@ NSEC HOST.Example.COM. A\n";
+
+  static const struct {
+    const uint8_t *owner;
+    size_t owner_length;
+    const uint8_t *rdata;
+    size_t rdlength;
+  } canonical[] = {
+    { NAME("\3www\7example\0"), NAME("\xc0\x00\x02\x01") },
+    { NAME("\1a\7example\3com\0"), NAME("\3ns1\7example\3com\0") },
+    { NAME("\7example\0"), NAME("\0\12\4mail\7example\0") },
+    { NAME("\42a-rather-long-label-to-span-blocks\7example\3com\0"),
+      NAME("\50another-rather-long-label-to-span-blocks\7example\3com\0") },
+    // names in NSEC RDATA are not converted (RFC 6840 section 5.1)
+    { NAME("\7example\0"), NAME("\4HOST\7Example\3COM\0\0\1\x40") }
+  };
+
+  recording_t *recording;
+
+  (void)state;
+
+  recording = malloc(sizeof(*recording));
+  assert_non_null(recording);
+
+  assert_int_equal(parse(text, true, recording), ZONE_SUCCESS);
+  assert_int_equal(recording->count, 5);
+  for (size_t i=0; i < 5; i++) {
+    assert_int_equal(recording->records[i].owner_length, canonical[i].owner_length);
+    assert_memory_equal(recording->records[i].owner, canonical[i].owner, canonical[i].owner_length);
+    assert_int_equal(recording->records[i].rdlength, canonical[i].rdlength);
+    assert_memory_equal(recording->records[i].rdata, canonical[i].rdata, canonical[i].rdlength);
+  }
+
+  // case is preserved by default
+  assert_int_equal(parse(text, false, recording), ZONE_SUCCESS);
+  assert_int_equal(recording->count, 5);
+  assert_memory_equal(recording->records[0].owner, "\3WWW\7ExAmPlE\0", 13);
+  assert_memory_equal(recording->records[1].rdata, "\3NS1\7EXAMPLE\3COM\0", 17);
+
+  free(recording);
+}
@@ -0,0 +1,195 @@
+/*
+ * checkpoint.c -- test resuming from checkpoints
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+#define MAX_RECORDS (2048)
+#define MAX_CHECKPOINTS (128)
+
+typedef struct saved_file saved_file_t;
+struct saved_file {
+  char path[512];
+  uint8_t origin[255], owner[255];
+  zone_checkpoint_file_t file;
+};
+
+typedef struct saved_checkpoint saved_checkpoint_t;
+struct saved_checkpoint {
+  size_t records; // number of records delivered before checkpoint
+  size_t depth;
+  saved_file_t files[4];
+};
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  uint64_t records[MAX_RECORDS];
+  size_t checkpoint_count;
+  saved_checkpoint_t checkpoints[MAX_CHECKPOINTS];
+};
+
+static int32_t record_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  if (recording->count == MAX_RECORDS)
+    return ZONE_OUT_OF_MEMORY;
+  recording->records[recording->count++] =
+    fingerprint(owner, type, class, ttl, rdlength, rdata);
+  return 0;
+}
+
+static int32_t save_checkpoint(
+  zone_parser_t *parser,
+  const zone_checkpoint_t *checkpoint,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  saved_checkpoint_t *saved;
+
+  (void)parser;
+  if (recording->checkpoint_count == MAX_CHECKPOINTS)
+    return 0;
+  if (checkpoint->depth > sizeof(saved->files)/sizeof(saved->files[0]))
+    return ZONE_OUT_OF_MEMORY;
+
+  saved = &recording->checkpoints[recording->checkpoint_count++];
+  saved->records = recording->count;
+  saved->depth = checkpoint->depth;
+  for (size_t i=0; i < checkpoint->depth; i++) {
+    const zone_checkpoint_file_t *file = &checkpoint->files[i];
+    saved_file_t *copy = &saved->files[i];
+    if (strlen(file->path) >= sizeof(copy->path))
+      return ZONE_OUT_OF_MEMORY;
+    strcpy(copy->path, file->path);
+    memcpy(copy->origin, file->origin.octets, file->origin.length);
+    memcpy(copy->owner, file->owner.octets, file->owner.length);
+    copy->file = *file;
+    copy->file.path = copy->path;
+    copy->file.origin.octets = copy->origin;
+    copy->file.owner.octets = copy->owner;
+  }
+
+  return 0;
+}
+
+static void initialize_options(zone_options_t *options)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+
+  memset(options, 0, sizeof(*options));
+  options->accept.callback = &record_rr;
+  options->origin.octets = origin;
+  options->origin.length = sizeof(origin);
+  options->default_ttl = 3600;
+  options->default_class = ZONE_CLASS_IN;
+}
+
+/*!cmocka */
+void resume_from_every_checkpoint(void **state)
+{
+  static const char include_fmt[] =
+    "inc%d A 192.0.2.%d\n"
+    "  TXT \"included %d\"\n";
+  static const char record_fmt[] =
+    "host%d 300 A 198.51.100.%d\n"
+    "   AAAA 2001:db8::%x\n";
+
+  static char buffer[65536];
+  char *include_path, *zone_path, *text;
+  int length = 0;
+
+  (void)state;
+
+  text = buffer;
+  for (int i=0; i < 200; i++)
+    length += snprintf(text + length, sizeof(buffer) - (size_t)length, include_fmt, i, i % 256, i);
+  include_path = write_file(text);
+  assert_non_null(include_path);
+
+  length = 0;
+  length += snprintf(text + length, sizeof(buffer) - (size_t)length,
+    "@ SOA ns hostmaster 1 3600 900 86400 3600\n");
+  for (int i=0; i < 300; i++)
+    length += snprintf(text + length, sizeof(buffer) - (size_t)length, record_fmt, i, i % 256, i);
+  length += snprintf(text + length, sizeof(buffer) - (size_t)length,
+    "$TTL 7200\n$ORIGIN sub.example.\n$INCLUDE %s\n  TXT \"after include\"\n",
+    include_path);
+  for (int i=300; i < 600; i++)
+    length += snprintf(text + length, sizeof(buffer) - (size_t)length, record_fmt, i, i % 256, i);
+  zone_path = write_file(text);
+  assert_non_null(zone_path);
+
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  recording_t *full, *resumed;
+  int32_t code;
+
+  full = calloc(1, sizeof(*full));
+  resumed = calloc(1, sizeof(*resumed));
+  assert_non_null(full);
+  assert_non_null(resumed);
+
+  initialize_options(&options);
+  options.checkpoint.interval = 1024;
+  options.checkpoint.callback = &save_checkpoint;
+
+  code = zone_parse(&parser, &options, &buffers, zone_path, full);
+  assert_int_equal(code, ZONE_SUCCESS);
+  assert_int_equal(full->count, 1 + 600 + 400 + 1 + 600);
+  assert_true(full->checkpoint_count > 10);
+
+  bool included = false;
+  initialize_options(&options);
+  for (size_t i=0; i < full->checkpoint_count; i++) {
+    const saved_checkpoint_t *saved = &full->checkpoints[i];
+    zone_checkpoint_file_t files[4];
+    for (size_t j=0; j < saved->depth; j++)
+      files[j] = saved->files[j].file;
+    if (saved->depth > 1)
+      included = true;
+
+    memset(resumed, 0, sizeof(*resumed));
+    code = zone_resume(
+      &parser, &options, &buffers,
+      &(zone_checkpoint_t){ saved->depth, files }, resumed);
+    assert_int_equal(code, ZONE_SUCCESS);
+    assert_int_equal(resumed->count, full->count - saved->records);
+    assert_memory_equal(resumed->records,
+                        full->records + saved->records,
+                        resumed->count * sizeof(resumed->records[0]));
+  }
+
+  assert_true(included);
+
+  free(full);
+  free(resumed);
+  remove(zone_path);
+  remove(include_path);
+  free(zone_path);
+  free(include_path);
+}
@@ -0,0 +1,298 @@
+/*
+ * diagnostics.c -- test structured diagnostics
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+typedef struct diagnostics diagnostics_t;
+struct diagnostics {
+  size_t count;
+  uint32_t priority;
+  int32_t code;
+  char field[32];
+  char type[32];
+  size_t line;
+  uint64_t offset;
+  char message[128];
+  bool format;
+  size_t logged;
+};
+
+static int32_t add_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  (void)parser;
+  (void)owner;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  (void)user_data;
+  return ZONE_SUCCESS;
+}
+
+static void diagnose(
+  zone_parser_t *parser,
+  const zone_diagnostic_t *diagnostic,
+  void *user_data)
+{
+  diagnostics_t *diagnostics = user_data;
+
+  (void)parser;
+  diagnostics->count++;
+  diagnostics->priority = diagnostic->priority;
+  diagnostics->code = diagnostic->code;
+  diagnostics->field[0] = diagnostics->type[0] = '\0';
+  if (diagnostic->field)
+    snprintf(diagnostics->field, sizeof(diagnostics->field), "%s", diagnostic->field);
+  if (diagnostic->type)
+    snprintf(diagnostics->type, sizeof(diagnostics->type), "%s", diagnostic->type);
+  diagnostics->line = diagnostic->line;
+  diagnostics->offset = diagnostic->offset;
+  if (diagnostics->format)
+    zone_format_diagnostic(
+      diagnostic, diagnostics->message, sizeof(diagnostics->message));
+}
+
+static void log_message(
+  zone_parser_t *parser,
+  uint32_t priority,
+  const char *file,
+  size_t line,
+  const char *message,
+  void *user_data)
+{
+  (void)parser;
+  (void)priority;
+  (void)file;
+  (void)line;
+  (void)message;
+  ((diagnostics_t *)user_data)->logged++;
+}
+
+static int32_t parse_diagnosed(
+  const char *text, bool secondary, diagnostics_t *diagnostics)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.accept.callback = &add_rr;
+  options.log.callback = &log_message;
+  options.log.diagnose = &diagnose;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+  options.secondary = secondary;
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, diagnostics);
+  free(input);
+  return code;
+}
+
+/*!cmocka */
+void invalid_field_diagnostic(void **state)
+{
+  static const char text[] =
+    "foo. A 192.0.2.1\n"
+    "bar. A 192.0.2\n";
+
+  diagnostics_t diagnostics;
+  int32_t code;
+
+  (void)state;
+
+  memset(&diagnostics, 0, sizeof(diagnostics));
+  code = parse_diagnosed(text, false, &diagnostics);
+  assert_int_equal(code, ZONE_SYNTAX_ERROR);
+  assert_int_equal(diagnostics.count, 1);
+  assert_int_equal(diagnostics.logged, 0);
+  assert_int_equal(diagnostics.priority, ZONE_ERROR);
+  assert_int_equal(diagnostics.code, ZONE_SYNTAX_ERROR);
+  assert_string_equal(diagnostics.field, "address");
+  assert_string_equal(diagnostics.type, "A");
+  assert_int_equal(diagnostics.line, 2);
+  // offset of "192.0.2" on second line
+  assert_int_equal(diagnostics.offset, strlen("foo. A 192.0.2.1\nbar. A "));
+  // messages are only formatted on request
+  assert_string_equal(diagnostics.message, "");
+
+  memset(&diagnostics, 0, sizeof(diagnostics));
+  diagnostics.format = true;
+  code = parse_diagnosed(text, false, &diagnostics);
+  assert_int_equal(code, ZONE_SYNTAX_ERROR);
+  assert_string_equal(diagnostics.message, "Invalid address in A");
+}
+
+/*!cmocka */
+void semantic_diagnostic(void **state)
+{
+  static const char text[] =
+    "$TTL 2147483648\n"
+    "foo. A 192.0.2.1\n";
+
+  diagnostics_t diagnostics;
+  int32_t code;
+
+  (void)state;
+
+  memset(&diagnostics, 0, sizeof(diagnostics));
+  code = parse_diagnosed(text, false, &diagnostics);
+  assert_int_equal(code, ZONE_SEMANTIC_ERROR);
+  assert_int_equal(diagnostics.count, 1);
+  assert_int_equal(diagnostics.priority, ZONE_ERROR);
+  assert_int_equal(diagnostics.code, ZONE_SEMANTIC_ERROR);
+  assert_string_equal(diagnostics.field, "ttl");
+  assert_string_equal(diagnostics.type, "$TTL");
+
+  // semantic errors are reported as warnings in secondary mode
+  memset(&diagnostics, 0, sizeof(diagnostics));
+  code = parse_diagnosed(text, true, &diagnostics);
+  assert_int_equal(code, ZONE_SUCCESS);
+  assert_int_equal(diagnostics.count, 1);
+  assert_int_equal(diagnostics.priority, ZONE_WARNING);
+  assert_int_equal(diagnostics.code, ZONE_SEMANTIC_ERROR);
+}
+
+/*!cmocka */
+void missing_field_diagnostic(void **state)
+{
+  static const char text[] = "foo. MX 10\n";
+
+  diagnostics_t diagnostics;
+  int32_t code;
+
+  (void)state;
+
+  memset(&diagnostics, 0, sizeof(diagnostics));
+  diagnostics.format = true;
+  code = parse_diagnosed(text, false, &diagnostics);
+  assert_int_equal(code, ZONE_SYNTAX_ERROR);
+  assert_int_equal(diagnostics.count, 1);
+  assert_int_equal(diagnostics.code, ZONE_SYNTAX_ERROR);
+  assert_string_equal(diagnostics.field, "hostname");
+  assert_string_equal(diagnostics.type, "MX");
+  assert_string_equal(diagnostics.message, "Missing hostname in MX");
+}
+
+/*!cmocka */
+void bitmap_diagnostic(void **state)
+{
+  // windows are out-of-order
+  static const char text[] =
+    "foo. NSEC \\# 11 03626172 00 01 01 40 00 01 40\n";
+
+  diagnostics_t diagnostics;
+  int32_t code;
+
+  (void)state;
+
+  memset(&diagnostics, 0, sizeof(diagnostics));
+  diagnostics.format = true;
+  code = parse_diagnosed(text, false, &diagnostics);
+  assert_int_equal(code, ZONE_SYNTAX_ERROR);
+  assert_int_equal(diagnostics.count, 1);
+  assert_int_equal(diagnostics.code, ZONE_SYNTAX_ERROR);
+  assert_string_equal(diagnostics.field, "types");
+  assert_string_equal(diagnostics.type, "NSEC");
+  assert_string_equal(
+    diagnostics.message, "Invalid types in NSEC, windows are out-of-order");
+}
+
+static int32_t warn_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  (void)owner;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  (void)user_data;
+  zone_warning(parser, "Record %s", "accepted");
+  return ZONE_SUCCESS;
+}
+
+/*!cmocka */
+void logged_diagnostic(void **state)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  static const char text[] = "foo. A 192.0.2.1\n";
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  diagnostics_t diagnostics;
+  int32_t code;
+  char input[sizeof(text) + ZONE_BLOCK_SIZE];
+
+  (void)state;
+
+  memset(input, 0, sizeof(input));
+  memcpy(input, text, sizeof(text) - 1);
+
+  for (size_t i=0; i < 2; i++) {
+    memset(&options, 0, sizeof(options));
+    options.accept.callback = &warn_rr;
+    options.log.diagnose = &diagnose;
+    options.log.mask = i ? ZONE_WARNING : 0;
+    options.origin.octets = origin;
+    options.origin.length = sizeof(origin);
+    options.default_ttl = 3600;
+    options.default_class = ZONE_CLASS_IN;
+
+    memset(&diagnostics, 0, sizeof(diagnostics));
+    diagnostics.format = true;
+    code = zone_parse_string(
+      &parser, &options, &buffers, input, sizeof(text) - 1, &diagnostics);
+    assert_int_equal(code, ZONE_SUCCESS);
+    if (i) {
+      // warnings are masked
+      assert_int_equal(diagnostics.count, 0);
+    } else {
+      assert_int_equal(diagnostics.count, 1);
+      assert_int_equal(diagnostics.priority, ZONE_WARNING);
+      assert_int_equal(diagnostics.code, 0);
+      assert_string_equal(diagnostics.field, "");
+      assert_string_equal(diagnostics.message, "Record accepted");
+    }
+  }
+}
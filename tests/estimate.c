@@ -0,0 +1,100 @@
+/*
+ * estimate.c -- test estimating size of zone files
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+static int32_t estimate_file(const char *content, zone_estimate_t *estimate)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  char *path;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  path = write_file(content);
+  assert_non_null(path);
+  code = zone_estimate(&parser, &options, &buffers, path, estimate);
+  remove(path);
+  free(path);
+  return code;
+}
+
+/*!cmocka */
+void estimate_records(void **state)
+{
+  static const char text[] =
+    "$ORIGIN example.\n"
+    "$TTL 3600\n"
+    "; comment\n"
+    "@ SOA ns hostmaster ( 1 ; serial\n"
+    "  3600 600 86400 3600 )\n"
+    "\n"
+    "  NS ns\n"
+    "  RRSIG NS 8 1 3600 20250101000000 20240101000000 12345 example. (\n"
+    "    aGVsbG8gd29ybGQ= )\n"
+    "ns A 192.0.2.1\n"
+    "   ; comment on a line of its own\n"
+    "  rrsig A 8 2 3600 20250101000000 20240101000000 12345 example. aGVsbG8=\n"
+    "\"quoted\" TXT \"RRSIG\"\n";
+
+  zone_estimate_t estimate;
+
+  (void)state;
+
+  assert_int_equal(estimate_file(text, &estimate), ZONE_SUCCESS);
+  assert_int_equal(estimate.octets, strlen(text));
+  assert_int_equal(estimate.lines, 13);
+  assert_int_equal(estimate.records, 6);
+  assert_int_equal(estimate.owners, 3);
+  assert_int_equal(estimate.blank_owners, 3);
+  assert_int_equal(estimate.signatures, 2);
+}
+
+/*!cmocka */
+void estimate_large_file(void **state)
+{
+  static char buffer[128 * 1024];
+  int length = 0;
+  zone_estimate_t estimate;
+
+  (void)state;
+
+  // spans multiple windows
+  for (int i=0; i < 2000; i++)
+    length += snprintf(buffer + length, sizeof(buffer) - (size_t)length,
+      "host%d A 192.0.2.%d\n"
+      "  TXT \"host %d\"\n", i, i % 256, i);
+
+  assert_int_equal(estimate_file(buffer, &estimate), ZONE_SUCCESS);
+  assert_int_equal(estimate.octets, (size_t)length);
+  assert_int_equal(estimate.lines, 4000);
+  assert_int_equal(estimate.records, 4000);
+  assert_int_equal(estimate.owners, 2000);
+  assert_int_equal(estimate.blank_owners, 2000);
+  assert_int_equal(estimate.fields, 2000 * 5);
+  assert_int_equal(estimate.signatures, 0);
+
+  assert_int_equal(estimate_file("foo. TXT ( \"unbalanced\"\n", &estimate), ZONE_SYNTAX_ERROR);
+}
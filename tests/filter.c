@@ -0,0 +1,133 @@
+/*
+ * filter.c -- test filtering RRs by type
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  uint16_t types[16];
+  size_t lines[16];
+};
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)owner;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  if (recording->count == 16)
+    return ZONE_OUT_OF_MEMORY;
+  recording->lines[recording->count] = parser->file->line;
+  recording->types[recording->count++] = type;
+  return 0;
+}
+
+static int32_t parse(
+  const char *text, const uint16_t *types, size_t count, bool deny,
+  recording_t *recording)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.accept.callback = &accept_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+  options.filter.types = types;
+  options.filter.count = count;
+  options.filter.deny = deny;
+
+  memset(recording, 0, sizeof(*recording));
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, recording);
+  free(input);
+  return code;
+}
+
+// RDATA of skipped RRs is not decoded and therefore need not be valid
+static const char zone[] =
+  "example. SOA ns hostmaster 1 3600 900 86400 3600\n"
+  "example. NS ns\n"
+  "example. RRSIG not decoded ( \"quoted ) text\"\n"
+  "  spanning\n"
+  "  lines )\n"
+  "ns A 192.0.2.1\n"
+  "ns CAA 0 issue \"ca.example.net\"\n"
+  "sub NS ns.sub\n"
+  "    DS 60485 5 1 2BB183AF5F22588179A53B0A98631FAD1A292118\n"
+  "    NSEC3 invalid\n"
+  "ns.sub AAAA 2001:db8::1";
+
+/*!cmocka */
+void filter_allowed_types(void **state)
+{
+  static const uint16_t types[] =
+    { ZONE_TYPE_NS, ZONE_TYPE_DS, ZONE_TYPE_A, ZONE_TYPE_AAAA };
+  static const uint16_t accepted[] =
+    { ZONE_TYPE_NS, ZONE_TYPE_A, ZONE_TYPE_NS, ZONE_TYPE_DS, ZONE_TYPE_AAAA };
+  static const size_t lines[] = { 2, 6, 8, 9, 11 };
+  recording_t recording;
+
+  (void)state;
+
+  assert_int_equal(parse(zone, types, 4, false, &recording), ZONE_SUCCESS);
+  assert_int_equal(recording.count, 5);
+  assert_memory_equal(recording.types, accepted, sizeof(accepted));
+  for (size_t i=0; i < 5; i++)
+    assert_int_equal(recording.lines[i], lines[i]);
+}
+
+/*!cmocka */
+void filter_denied_types(void **state)
+{
+  static const uint16_t types[] =
+    { ZONE_TYPE_RRSIG, ZONE_TYPE_NSEC3, ZONE_TYPE_CAA };
+  static const uint16_t accepted[] = {
+    ZONE_TYPE_SOA, ZONE_TYPE_NS, ZONE_TYPE_A, ZONE_TYPE_NS, ZONE_TYPE_DS,
+    ZONE_TYPE_AAAA };
+  recording_t recording;
+
+  (void)state;
+
+  assert_int_equal(parse(zone, types, 3, true, &recording), ZONE_SUCCESS);
+  assert_int_equal(recording.count, 6);
+  assert_memory_equal(recording.types, accepted, sizeof(accepted));
+
+  // without a filter the invalid RDATA is reported
+  assert_int_equal(parse(zone, NULL, 0, false, &recording), ZONE_SYNTAX_ERROR);
+}
@@ -0,0 +1,143 @@
+/*
+ * hash.c -- test case-insensitive owner hash
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  size_t mismatches;
+  uint32_t hashes[64];
+};
+
+// bitwise CRC32C for reference
+static uint32_t crc32c(const uint8_t *octets, size_t length)
+{
+  uint32_t crc = 0xffffffffu;
+  for (size_t i=0; i < length; i++) {
+    uint8_t octet = octets[i];
+    if (octet >= 'A' && octet <= 'Z')
+      octet |= 0x20;
+    crc ^= octet;
+    for (int bit=0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1u)));
+  }
+  return ~crc;
+}
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  if (recording->count == 64)
+    return ZONE_OUT_OF_MEMORY;
+  if (zone_owner_hash(parser) != crc32c(owner->octets, owner->length))
+    recording->mismatches++;
+  recording->hashes[recording->count++] = zone_owner_hash(parser);
+  return 0;
+}
+
+static int32_t accept_batch(
+  zone_parser_t *parser,
+  const zone_batch_t *batch,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  for (size_t i=0; i < batch->count; i++) {
+    if (recording->count == 64)
+      return ZONE_OUT_OF_MEMORY;
+    recording->hashes[recording->count++] = batch->hashes[i];
+  }
+  return 0;
+}
+
+static int32_t parse(const char *text, bool batch, recording_t *recording)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t names[4];
+  zone_rdata_buffer_t rdata[4];
+  zone_buffers_t buffers = { 4, names, rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  if (batch)
+    options.batch.callback = &accept_batch;
+  else
+    options.accept.callback = &accept_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+  options.hash_owners = true;
+
+  memset(recording, 0, sizeof(*recording));
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, recording);
+  free(input);
+  return code;
+}
+
+/*!cmocka */
+void owner_hash(void **state)
+{
+  // owners of various lengths to cover full and partial blocks
+  static const char text[] =
+    "example. A 192.0.2.1\n"
+    "a A 192.0.2.1\n"
+    "A A 192.0.2.1\n"
+    "  TXT \"blank owner\"\n"
+    "Mixed-Case.Owner A 192.0.2.1\n"
+    "mixed-case.owner A 192.0.2.1\n"
+    "\\192\\200.\\@[\\`{ A 192.0.2.1\n"
+    "sixteen-octets-label.thirty-two-octets-and-more-label A 192.0.2.1\n"
+    "THIS.IS.A.RATHER.LONG.OWNER.NAME.WITH.MANY.LABELS.THAT.SPANS.SEVERAL.BLOCKS"
+    ".OF.SIXTEEN.OCTETS A 192.0.2.1\n";
+
+  recording_t recording, batched;
+
+  (void)state;
+
+  assert_int_equal(parse(text, false, &recording), ZONE_SUCCESS);
+  assert_int_equal(recording.count, 9);
+  assert_int_equal(recording.mismatches, 0);
+  // hash is case-insensitive
+  assert_int_equal(recording.hashes[1], recording.hashes[2]);
+  assert_int_equal(recording.hashes[2], recording.hashes[3]);
+  assert_int_equal(recording.hashes[4], recording.hashes[5]);
+
+  assert_int_equal(parse(text, true, &batched), ZONE_SUCCESS);
+  assert_int_equal(batched.count, 9);
+  assert_memory_equal(batched.hashes, recording.hashes, 9 * sizeof(uint32_t));
+}
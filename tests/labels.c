@@ -0,0 +1,147 @@
+/*
+ * labels.c -- test indexing of owner labels
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  size_t mismatches;
+  zone_labels_t labels[8];
+};
+
+// labels are verified against the owner passed to the callback
+static bool is_match(const zone_name_t *owner, const zone_labels_t *labels)
+{
+  size_t offset = 0;
+  for (size_t i=0; i < labels->count; i++) {
+    if (labels->offsets[i] != offset)
+      return false;
+    offset += owner->octets[offset] + 1;
+  }
+  return offset == owner->length;
+}
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  if (recording->count == 8)
+    return ZONE_OUT_OF_MEMORY;
+  if (!is_match(owner, zone_owner_labels(parser)))
+    recording->mismatches++;
+  recording->labels[recording->count++] = *zone_owner_labels(parser);
+  return 0;
+}
+
+static int32_t accept_rrset(
+  zone_parser_t *parser,
+  const zone_rrset_t *rrset,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  if (recording->count == 8)
+    return ZONE_OUT_OF_MEMORY;
+  if (!is_match(&rrset->owner, &rrset->labels))
+    recording->mismatches++;
+  recording->labels[recording->count++] = rrset->labels;
+  return 0;
+}
+
+static int32_t parse(const char *text, bool rrset, recording_t *recording)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t names[4];
+  zone_rdata_buffer_t rdata[4];
+  zone_buffers_t buffers = { 4, names, rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  if (rrset)
+    options.rrset.callback = &accept_rrset;
+  else
+    options.accept.callback = &accept_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+  options.owner_labels = true;
+
+  memset(recording, 0, sizeof(*recording));
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, recording);
+  free(input);
+  return code;
+}
+
+/*!cmocka */
+void owner_labels(void **state)
+{
+  static const char text[] =
+    ". A 192.0.2.1\n"
+    "@ A 192.0.2.1\n"
+    "www A 192.0.2.1\n"
+    "    TXT \"blank owner\"\n"
+    "a\\.b.c\\046d.example.net. A 192.0.2.1\n";
+
+  static const struct {
+    uint8_t count;
+    uint8_t offsets[5];
+  } labels[] = {
+    { 1, { 0 } },
+    { 2, { 0, 8 } },
+    { 3, { 0, 4, 12 } },
+    { 3, { 0, 4, 12 } },
+    { 5, { 0, 4, 8, 16, 20 } }
+  };
+
+  recording_t recording;
+
+  (void)state;
+
+  assert_int_equal(parse(text, false, &recording), ZONE_SUCCESS);
+  assert_int_equal(recording.count, 5);
+  assert_int_equal(recording.mismatches, 0);
+  for (size_t i=0; i < 5; i++) {
+    assert_int_equal(recording.labels[i].count, labels[i].count);
+    assert_memory_equal(recording.labels[i].offsets, labels[i].offsets, labels[i].count);
+  }
+
+  // RRsets carry the labels of their owner
+  assert_int_equal(parse(text, true, &recording), ZONE_SUCCESS);
+  assert_int_equal(recording.count, 5);
+  assert_int_equal(recording.mismatches, 0);
+  assert_int_equal(recording.labels[4].count, 5);
+}
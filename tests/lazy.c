@@ -0,0 +1,226 @@
+/*
+ * lazy.c -- test decoding RDATA on demand
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+#define RECORDS (4000)
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  size_t errors;
+  uint64_t records[RECORDS];
+  size_t lines[RECORDS];
+};
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  if (recording->count == RECORDS)
+    return ZONE_OUT_OF_MEMORY;
+  recording->lines[recording->count] = parser->file->line;
+  recording->records[recording->count++] =
+    fingerprint(owner, type, class, ttl, rdlength, rdata);
+  return 0;
+}
+
+// decode RDATA of every RR, twice, to verify the handle can be reused
+static int32_t decode_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  zone_lazy_rdata_t *rdata,
+  void *user_data)
+{
+  static zone_rdata_buffer_t buffers[2];
+  recording_t *recording = user_data;
+  int32_t length[2];
+
+  length[0] = zone_decode_rdata(rdata, &buffers[0]);
+  length[1] = zone_decode_rdata(rdata, &buffers[1]);
+  if (length[0] != length[1])
+    return ZONE_SEMANTIC_ERROR;
+  if (length[0] < 0) {
+    recording->errors++;
+    return 0;
+  }
+  if (memcmp(buffers[0].octets, buffers[1].octets, (size_t)length[0]) != 0)
+    return ZONE_SEMANTIC_ERROR;
+  return accept_rr(
+    parser, owner, type, class, ttl, (uint16_t)length[0], buffers[0].octets, user_data);
+}
+
+// decode RDATA of A RRs only
+static int32_t decode_a_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  zone_lazy_rdata_t *rdata,
+  void *user_data)
+{
+  zone_rdata_buffer_t buffer;
+  int32_t length;
+
+  if (type != ZONE_TYPE_A)
+    return 0;
+  if ((length = zone_decode_rdata(rdata, &buffer)) < 0)
+    return length;
+  return accept_rr(
+    parser, owner, type, class, ttl, (uint16_t)length, buffer.octets, user_data);
+}
+
+static void initialize_options(zone_options_t *options)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+
+  memset(options, 0, sizeof(*options));
+  options->origin.octets = origin;
+  options->origin.length = sizeof(origin);
+  options->default_ttl = 3600;
+  options->default_class = ZONE_CLASS_IN;
+}
+
+static int32_t parse_string(
+  const zone_options_t *options, const char *text, recording_t *recording)
+{
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  int32_t code;
+
+  memset(recording, 0, sizeof(*recording));
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, options, &buffers, input, length, recording);
+  free(input);
+  return code;
+}
+
+/*!cmocka */
+void lazy_decode_on_demand(void **state)
+{
+  static const char text[] =
+    "foo A 192.0.2.1\n"
+    "    TXT ( \"not\" \"decoded\"\n"
+    "          \"on demand\" )\n"
+    "    RRSIG invalid\n"
+    "bar A 192.0.2.2\n"
+    "    MX 10 mail.example.\n";
+
+  zone_options_t options;
+  recording_t *expected, *decoded;
+
+  (void)state;
+
+  expected = malloc(sizeof(*expected));
+  decoded = malloc(sizeof(*decoded));
+  assert_non_null(expected);
+  assert_non_null(decoded);
+
+  initialize_options(&options);
+  options.lazy.callback = &decode_a_rr;
+  assert_int_equal(parse_string(&options, text, decoded), ZONE_SUCCESS);
+  assert_int_equal(decoded->count, 2);
+  assert_int_equal(decoded->lines[0], 1);
+  assert_int_equal(decoded->lines[1], 5);
+
+  // decoding errors are reported to the callback, parsing continues
+  options.lazy.callback = &decode_rr;
+  assert_int_equal(parse_string(&options, text, decoded), ZONE_SUCCESS);
+  assert_int_equal(decoded->count, 4);
+  assert_int_equal(decoded->errors, 1);
+  assert_int_equal(decoded->lines[3], 6);
+
+  initialize_options(&options);
+  options.accept.callback = &accept_rr;
+  assert_int_equal(parse_string(&options, text, expected), ZONE_SYNTAX_ERROR);
+  assert_int_equal(expected->count, 2);
+  assert_memory_equal(decoded->records, expected->records, 2 * sizeof(uint64_t));
+
+  free(expected);
+  free(decoded);
+}
+
+/*!cmocka */
+void lazy_matches_accept(void **state)
+{
+  static const char record_fmt[] =
+    "host%d A 192.0.2.%d\n"
+    "  TXT ( \"host %d\"\n"
+    "        \"spans lines\" )\n";
+  char *text, *path;
+  size_t length = 0, size = RECORDS * 64;
+
+  (void)state;
+
+  // records cross buffer boundaries
+  text = malloc(size);
+  assert_non_null(text);
+  for (int i=0; i < RECORDS / 2; i++)
+    length += (size_t)snprintf(
+      text + length, size - length, record_fmt, i, i % 256, i);
+  assert_true(length > 4 * ZONE_WINDOW_SIZE);
+  path = write_file(text);
+  assert_non_null(path);
+
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  recording_t *expected, *decoded;
+
+  expected = calloc(1, sizeof(*expected));
+  decoded = calloc(1, sizeof(*decoded));
+  assert_non_null(expected);
+  assert_non_null(decoded);
+
+  initialize_options(&options);
+  options.accept.callback = &accept_rr;
+  assert_int_equal(zone_parse(&parser, &options, &buffers, path, expected), ZONE_SUCCESS);
+  assert_int_equal(expected->count, RECORDS);
+
+  initialize_options(&options);
+  options.lazy.callback = &decode_rr;
+  assert_int_equal(zone_parse(&parser, &options, &buffers, path, decoded), ZONE_SUCCESS);
+  assert_int_equal(decoded->count, RECORDS);
+  assert_int_equal(decoded->errors, 0);
+  assert_memory_equal(decoded->records, expected->records, sizeof(expected->records));
+  assert_memory_equal(decoded->lines, expected->lines, sizeof(expected->lines));
+
+  free(expected);
+  free(decoded);
+  remove(path);
+  free(path);
+  free(text);
+}
@@ -0,0 +1,182 @@
+/*
+ * next.c -- test retrieving RRs one at a time
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+#define RECORDS (1000)
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  uint64_t records[RECORDS];
+};
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  if (recording->count == RECORDS)
+    return ZONE_OUT_OF_MEMORY;
+  recording->records[recording->count++] =
+    fingerprint(owner, type, class, ttl, rdlength, rdata);
+  return 0;
+}
+
+static void initialize_options(zone_options_t *options)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+
+  memset(options, 0, sizeof(*options));
+  options->origin.octets = origin;
+  options->origin.length = sizeof(origin);
+  options->default_ttl = 3600;
+  options->default_class = ZONE_CLASS_IN;
+}
+
+/*!cmocka */
+void next_matches_accept(void **state)
+{
+  static const char record_fmt[] =
+    "host%d A 192.0.2.%d\n"
+    "  TXT \"host %d\"\n";
+  static char buffer[65536];
+  char *include_path, *zone_path;
+  int length = 0;
+
+  (void)state;
+
+  for (int i=0; i < 100; i++)
+    length += snprintf(buffer + length, sizeof(buffer) - (size_t)length, record_fmt, i, i, i);
+  include_path = write_file(buffer);
+  assert_non_null(include_path);
+
+  length = 0;
+  length += snprintf(buffer + length, sizeof(buffer) - (size_t)length,
+    "@ SOA ns hostmaster 1 3600 900 86400 3600\n"
+    "$INCLUDE %s sub.example.\n", include_path);
+  for (int i=100; i < 300; i++)
+    length += snprintf(buffer + length, sizeof(buffer) - (size_t)length, record_fmt, i, i % 256, i);
+  zone_path = write_file(buffer);
+  assert_non_null(zone_path);
+
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  recording_t *expected, *pulled;
+  zone_rr_t rr;
+  int32_t code;
+
+  expected = calloc(1, sizeof(*expected));
+  pulled = calloc(1, sizeof(*pulled));
+  assert_non_null(expected);
+  assert_non_null(pulled);
+
+  initialize_options(&options);
+  options.accept.callback = &accept_rr;
+  code = zone_parse(&parser, &options, &buffers, zone_path, expected);
+  assert_int_equal(code, ZONE_SUCCESS);
+  assert_int_equal(expected->count, 1 + 600);
+
+  initialize_options(&options);
+  code = zone_open(&parser, &options, &buffers, zone_path, NULL);
+  assert_int_equal(code, ZONE_SUCCESS);
+  while ((code = zone_next(&parser, &rr)) == 1) {
+    assert_true(pulled->count < RECORDS);
+    pulled->records[pulled->count++] = fingerprint(
+      &rr.owner, rr.type, rr.class, rr.ttl, rr.rdlength, rr.rdata);
+  }
+  assert_int_equal(code, ZONE_SUCCESS);
+  // end of input is sticky
+  assert_int_equal(zone_next(&parser, &rr), ZONE_SUCCESS);
+  zone_close(&parser);
+
+  assert_int_equal(pulled->count, expected->count);
+  assert_memory_equal(pulled->records, expected->records,
+                      expected->count * sizeof(expected->records[0]));
+
+  // push-based parsing requires an accept callback
+  initialize_options(&options);
+  code = zone_parse(&parser, &options, &buffers, zone_path, NULL);
+  assert_int_equal(code, ZONE_BAD_PARAMETER);
+
+  free(expected);
+  free(pulled);
+  remove(zone_path);
+  remove(include_path);
+  free(zone_path);
+  free(include_path);
+}
+
+static int32_t positive_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  (void)parser;
+  (void)owner;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  (*(size_t *)user_data)++;
+  return 5;
+}
+
+/*!cmocka */
+void positive_accept_continues(void **state)
+{
+  static const char text[] =
+    "foo. A 192.0.2.1\n"
+    "bar. A 192.0.2.2\n"
+    "baz. A 192.0.2.3\n";
+
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  char input[sizeof(text) + ZONE_BLOCK_SIZE];
+  size_t count = 0;
+  int32_t code;
+
+  (void)state;
+
+  // positive codes only stop parsing if RRs are pulled
+  memset(input, 0, sizeof(input));
+  memcpy(input, text, sizeof(text) - 1);
+  initialize_options(&options);
+  options.accept.callback = &positive_rr;
+  code = zone_parse_string(
+    &parser, &options, &buffers, input, sizeof(text) - 1, &count);
+  assert_int_equal(code, 5);
+  assert_int_equal(count, 3);
+}
@@ -0,0 +1,170 @@
+/*
+ * partition.c -- test partitioning of RRs by owner
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include <ctype.h>
+
+#include "zone.h"
+
+typedef struct partitions partitions_t;
+struct partitions {
+  size_t count;
+  size_t records;
+  struct {
+    uint8_t length;
+    uint8_t octets[255];
+    size_t partition;
+  } owners[16];
+  size_t owner_count;
+  int32_t result;
+};
+
+static int32_t partition_rr(
+  zone_parser_t *parser,
+  size_t partition,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  partitions_t *partitions = user_data;
+  uint8_t octets[255];
+
+  (void)parser;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+
+  partitions->records++;
+  if (partition >= partitions->count)
+    return (partitions->result = ZONE_SEMANTIC_ERROR);
+
+  for (size_t i=0; i < owner->length; i++)
+    octets[i] = (uint8_t)tolower(owner->octets[i]);
+
+  for (size_t i=0; i < partitions->owner_count; i++) {
+    if (partitions->owners[i].length != owner->length ||
+        memcmp(partitions->owners[i].octets, octets, owner->length) != 0)
+      continue;
+    // RRs with the same owner must be routed to the same partition
+    if (partitions->owners[i].partition != partition)
+      return (partitions->result = ZONE_SEMANTIC_ERROR);
+    return 0;
+  }
+
+  size_t i = partitions->owner_count++;
+  if (i >= sizeof(partitions->owners)/sizeof(partitions->owners[0]))
+    return (partitions->result = ZONE_OUT_OF_MEMORY);
+  partitions->owners[i].length = owner->length;
+  memcpy(partitions->owners[i].octets, octets, owner->length);
+  partitions->owners[i].partition = partition;
+  return 0;
+}
+
+static int32_t parse_partitioned(
+  const char *text, size_t count, partitions_t *partitions)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.partition.count = count;
+  options.partition.callback = &partition_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  memset(partitions, 0, sizeof(*partitions));
+  partitions->count = count;
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, partitions);
+  free(input);
+  return code;
+}
+
+static const char zone[] =
+  "$TTL 3600\n"
+  "@ IN SOA ns hostmaster 1 3600 900 86400 3600\n"
+  "  IN NS ns\n"
+  "ns A 192.0.2.1\n"
+  "   AAAA 2001:db8::1\n"
+  "www A 192.0.2.2\n"
+  "WWW A 192.0.2.3\n"
+  "mail A 192.0.2.4\n"
+  "ftp A 192.0.2.5\n"
+  "Ns.Example. TXT \"foobar\"\n"
+  "a.b.c A 192.0.2.6\n"
+  "  A 192.0.2.7\n";
+
+/*!cmocka */
+void owners_map_to_same_partition(void **state)
+{
+  partitions_t partitions;
+
+  (void)state;
+
+  for (size_t count=1; count <= 8; count++) {
+    int32_t code = parse_partitioned(zone, count, &partitions);
+    assert_int_equal(code, ZONE_SUCCESS);
+    assert_int_equal(partitions.result, ZONE_SUCCESS);
+    assert_int_equal(partitions.records, 11);
+    assert_int_equal(partitions.owner_count, 6);
+    if (count == 1)
+      for (size_t i=0; i < partitions.owner_count; i++)
+        assert_int_equal(partitions.owners[i].partition, 0);
+  }
+}
+
+/*!cmocka */
+void partition_requires_callback(void **state)
+{
+  static const uint8_t origin[] = { 0 };
+  static const char text[] = "foo. A 192.0.2.1\n";
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  char input[sizeof(text) + ZONE_BLOCK_SIZE];
+  int32_t code;
+
+  (void)state;
+
+  memset(input, 0, sizeof(input));
+  memcpy(input, text, sizeof(text) - 1);
+  memset(&options, 0, sizeof(options));
+  options.partition.count = 4;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  code = zone_parse_string(
+    &parser, &options, &buffers, input, sizeof(text) - 1, NULL);
+  assert_int_equal(code, ZONE_BAD_PARAMETER);
+}
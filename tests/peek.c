@@ -0,0 +1,129 @@
+/*
+ * peek.c -- test retrieving SOA without parsing entire zone
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "diagnostic.h"
+#include "tools.h"
+
+static void initialize_options(zone_options_t *options)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+
+  memset(options, 0, sizeof(*options));
+  options->origin.octets = origin;
+  options->origin.length = sizeof(origin);
+  options->default_ttl = 3600;
+  options->default_class = ZONE_CLASS_IN;
+}
+
+static int32_t peek_string(const char *text, zone_soa_t *soa)
+{
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  initialize_options(&options);
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_peek_soa_string(&parser, &options, &buffers, input, length, soa);
+  free(input);
+  return code;
+}
+
+// entries that follow the SOA RR are invalid on purpose, they must not be
+// parsed. RDATA of RRs that precede it is skipped
+static const char zone[] =
+  "$ORIGIN example.com.\n"
+  "$TTL 300\n"
+  "www A 192.0.2.1\n"
+  "@ SOA ns hostmaster.example.net. ( 2025010101 ; serial\n"
+  "      7200 900 1209600 60 )\n"
+  "www NOT-A-TYPE not-an-address\n";
+
+static void check_soa(const zone_soa_t *soa)
+{
+  assert_int_equal(soa->owner.length, 13);
+  assert_memory_equal(soa->owner.octets, "\7example\3com\0", 13);
+  assert_int_equal(soa->class, ZONE_CLASS_IN);
+  assert_int_equal(soa->ttl, 300);
+  assert_int_equal(soa->primary.length, 16);
+  assert_memory_equal(soa->primary.octets, "\2ns\7example\3com\0", 16);
+  assert_int_equal(soa->mailbox.length, 24);
+  assert_memory_equal(soa->mailbox.octets, "\12hostmaster\7example\3net\0", 24);
+  assert_int_equal(soa->serial, 2025010101u);
+  assert_int_equal(soa->refresh, 7200);
+  assert_int_equal(soa->retry, 900);
+  assert_int_equal(soa->expire, 1209600);
+  assert_int_equal(soa->minimum, 60);
+}
+
+/*!cmocka */
+void peek_soa_in_string(void **state)
+{
+  zone_soa_t soa;
+
+  (void)state;
+
+  assert_int_equal(peek_string(zone, &soa), ZONE_SUCCESS);
+  check_soa(&soa);
+  assert_int_equal(peek_string("www A 192.0.2.1\n", &soa), ZONE_SEMANTIC_ERROR);
+  assert_int_equal(peek_string("@ SOA ns hostmaster 1 2 3 4\n", &soa), ZONE_SYNTAX_ERROR);
+}
+
+/*!cmocka */
+void peek_soa_in_file(void **state)
+{
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  zone_soa_t soa;
+  char *path = NULL;
+  FILE *handle = NULL;
+
+  (void)state;
+
+  for (int i=0; i < 100 && !handle; i++) {
+    if (path)
+      free(path);
+    path = get_tempnam(NULL, "zone");
+    assert_non_null(path);
+diagnostic_push()
+msvc_diagnostic_ignored(4996)
+    handle = fopen(path, "wbx");
+diagnostic_pop()
+  }
+
+  assert_non_null(handle);
+  (void)fputs(zone, handle);
+  // pad file so that it spans multiple windows
+  for (int i=0; i < 2000; i++)
+    (void)fprintf(handle, "host%d A 192.0.2.%d\n", i, i % 256);
+  (void)fclose(handle);
+
+  initialize_options(&options);
+  assert_int_equal(zone_peek_soa(&parser, &options, &buffers, path, &soa), ZONE_SUCCESS);
+  check_soa(&soa);
+
+  remove(path);
+  free(path);
+}
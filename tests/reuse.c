@@ -0,0 +1,221 @@
+/*
+ * reuse.c -- test reusable parsers
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+typedef struct counts counts_t;
+struct counts {
+  size_t records;
+  size_t octets;
+};
+
+static int32_t count_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  counts_t *counts = user_data;
+  (void)parser;
+  (void)owner;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdata;
+  counts->records++;
+  counts->octets += rdlength;
+  return 0;
+}
+
+static void initialize_options(zone_options_t *options)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+
+  memset(options, 0, sizeof(*options));
+  options->accept.callback = &count_rr;
+  options->origin.octets = origin;
+  options->origin.length = sizeof(origin);
+  options->default_ttl = 3600;
+  options->default_class = ZONE_CLASS_IN;
+}
+
+/*!cmocka */
+void reuse_parser_for_strings(void **state)
+{
+  static const char *zones[] = {
+    "foo. A 192.0.2.1\n",
+    "$ORIGIN bar.\n@ TXT \"a\" \"b\"\nbaz AAAA 2001:db8::1\n",
+    "foo. A 192.0.2.1 ; unterminated\n  TXT \"",
+    "foo. NS ns.foo.\n"
+  };
+
+  static const struct { int32_t code; size_t records, octets; } results[] = {
+    { ZONE_SUCCESS, 1, 4 },
+    { ZONE_SUCCESS, 2, 4 + 16 },
+    { ZONE_SYNTAX_ERROR, 1, 4 },
+    { ZONE_SUCCESS, 1, 8 }
+  };
+
+  zone_parser_t *parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+
+  (void)state;
+
+  initialize_options(&options);
+  parser = zone_parser_create();
+  assert_non_null(parser);
+
+  // parser must be reset before every zone
+  assert_int_equal(zone_parser_parse_string(parser, "", 0), ZONE_BAD_PARAMETER);
+
+  for (size_t round=0; round < 3; round++) {
+    for (size_t i=0; i < sizeof(zones)/sizeof(zones[0]); i++) {
+      counts_t counts = { 0, 0 };
+      const size_t length = strlen(zones[i]);
+      char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+      assert_non_null(input);
+      memcpy(input, zones[i], length);
+      memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+
+      assert_int_equal(zone_parser_reset(parser, &options, &buffers, &counts), 0);
+      int32_t code = zone_parser_parse_string(parser, input, length);
+      assert_int_equal(code, results[i].code);
+      assert_int_equal(counts.records, results[i].records);
+      assert_int_equal(counts.octets, results[i].octets);
+      assert_int_equal(
+        zone_parser_parse_string(parser, input, length), ZONE_BAD_PARAMETER);
+      free(input);
+    }
+  }
+
+  zone_parser_destroy(parser);
+}
+
+/*!cmocka */
+void reuse_parser_for_files(void **state)
+{
+  static char buffer[65536];
+  int length = 0;
+  char *path;
+
+  (void)state;
+
+  // spans multiple windows
+  for (int i=0; i < 2000; i++)
+    length += snprintf(buffer + length, sizeof(buffer) - (size_t)length,
+      "host%d A 192.0.2.%d\n", i, i % 256);
+  path = write_file(buffer);
+  assert_non_null(path);
+
+  zone_parser_t *parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+
+  initialize_options(&options);
+  parser = zone_parser_create();
+  assert_non_null(parser);
+
+  for (size_t round=0; round < 4; round++) {
+    counts_t counts = { 0, 0 };
+    assert_int_equal(zone_parser_reset(parser, &options, &buffers, &counts), 0);
+    assert_int_equal(zone_parser_parse(parser, path), ZONE_SUCCESS);
+    assert_int_equal(counts.records, 2000);
+    assert_int_equal(counts.octets, 2000 * 4);
+  }
+
+  // bad options leave the parser intact
+  options.default_ttl = 0;
+  assert_int_equal(zone_parser_reset(parser, &options, &buffers, NULL), ZONE_BAD_PARAMETER);
+  assert_int_equal(zone_parser_parse(parser, path), ZONE_BAD_PARAMETER);
+  initialize_options(&options);
+  counts_t counts = { 0, 0 };
+  assert_int_equal(zone_parser_reset(parser, &options, &buffers, &counts), 0);
+  assert_int_equal(zone_parser_parse(parser, path), ZONE_SUCCESS);
+  assert_int_equal(counts.records, 2000);
+
+  zone_parser_destroy(parser);
+  remove(path);
+  free(path);
+}
+
+/*!cmocka */
+void parse_single_rr(void **state)
+{
+  // input is neither terminated nor padded
+  static const char input[] =
+    "foo A 192.0.2.1garbage"
+    "baz TXT \"a\""
+    "foo. A 192.0.2.1\nbar. A 192.0.2.2\n"
+    "; comment\n"
+    "$INCLUDE foo.zone\n";
+  static const uint8_t bar[] = { 3, 'b', 'a', 'r', 0 };
+  static const zone_name_t origin = { sizeof(bar), bar };
+
+  zone_parser_t *parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  zone_rr_t rr;
+  const char *text = input;
+
+  (void)state;
+
+  initialize_options(&options);
+  parser = zone_parser_create();
+  assert_non_null(parser);
+
+  // parser must be reset once
+  assert_int_equal(zone_parse_rr(parser, text, 15, NULL, 3600, &rr), ZONE_BAD_PARAMETER);
+  assert_int_equal(zone_parser_reset(parser, &options, &buffers, NULL), 0);
+
+  for (size_t round=0; round < 2; round++) {
+    text = input;
+    assert_int_equal(zone_parse_rr(parser, text, 15, NULL, 3600, &rr), ZONE_SUCCESS);
+    assert_int_equal(rr.owner.length, 13);
+    assert_memory_equal(rr.owner.octets, "\3foo\7example\0", 13);
+    assert_int_equal(rr.type, ZONE_TYPE_A);
+    assert_int_equal(rr.ttl, 3600);
+    assert_int_equal(rr.rdlength, 4);
+    assert_memory_equal(rr.rdata, "\xc0\x00\x02\x01", 4);
+    text += 22;
+
+    assert_int_equal(zone_parse_rr(parser, text, 11, &origin, 60, &rr), ZONE_SUCCESS);
+    assert_int_equal(rr.owner.length, 9);
+    assert_memory_equal(rr.owner.octets, "\3baz\3bar\0", 9);
+    assert_int_equal(rr.type, ZONE_TYPE_TXT);
+    assert_int_equal(rr.ttl, 60);
+    assert_int_equal(rr.rdlength, 2);
+    text += 11;
+
+    assert_int_equal(zone_parse_rr(parser, text, 34, NULL, 3600, &rr), ZONE_SYNTAX_ERROR);
+    text += 34;
+    assert_int_equal(zone_parse_rr(parser, text, 10, NULL, 3600, &rr), ZONE_SYNTAX_ERROR);
+    text += 10;
+    assert_true(zone_parse_rr(parser, text, strlen(text), NULL, 3600, &rr) < 0);
+  }
+
+  zone_parser_destroy(parser);
+}
@@ -0,0 +1,195 @@
+/*
+ * rrset.c -- test delivery of RRs grouped by RRset
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  int32_t code;
+  struct {
+    uint8_t owner[255];
+    size_t length;
+    uint16_t type;
+    size_t count;
+    uint32_t ttls[8];
+    uint8_t rdata[8];
+  } rrsets[16];
+};
+
+static int32_t accept_rrset(
+  zone_parser_t *parser,
+  const zone_rrset_t *rrset,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  if (!rrset->count || rrset->count > 8 || recording->count == 16)
+    return ZONE_SEMANTIC_ERROR;
+  const size_t index = recording->count++;
+  memcpy(recording->rrsets[index].owner, rrset->owner.octets, rrset->owner.length);
+  recording->rrsets[index].length = rrset->owner.length;
+  recording->rrsets[index].type = rrset->type;
+  recording->rrsets[index].count = rrset->count;
+  // rdata is inspected after the RRset is complete to verify that every
+  // rdata buffer remains valid for the duration of the callback
+  for (size_t i=0; i < rrset->count; i++) {
+    recording->rrsets[index].ttls[i] = rrset->ttls[i];
+    recording->rrsets[index].rdata[i] = rrset->rdata[i][rrset->rdlengths[i] - 1];
+  }
+  return recording->code;
+}
+
+static int32_t parse_with_code(
+  const char *text, size_t size, int32_t callback_code, recording_t *recording)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_buffers_t buffers;
+  zone_options_t options;
+  int32_t code;
+
+  buffers.size = size;
+  buffers.owner = calloc(size, sizeof(*buffers.owner));
+  buffers.rdata = calloc(size, sizeof(*buffers.rdata));
+  assert_non_null(buffers.owner);
+  assert_non_null(buffers.rdata);
+
+  memset(&options, 0, sizeof(options));
+  options.rrset.callback = &accept_rrset;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  memset(recording, 0, sizeof(*recording));
+  recording->code = callback_code;
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, recording);
+  free(input);
+  free(buffers.owner);
+  free(buffers.rdata);
+  return code;
+}
+
+static int32_t parse(const char *text, size_t size, recording_t *recording)
+{
+  return parse_with_code(text, size, 0, recording);
+}
+
+/*!cmocka */
+void rrsets_group_records(void **state)
+{
+  static const char text[] =
+    "foo 300 A 192.0.2.1\n"
+    "    600 A 192.0.2.2\n"
+    "FOO A 192.0.2.3\n"
+    "foo AAAA 2001:db8::4\n"
+    "bar AAAA 2001:db8::5\n"
+    "bar AAAA 2001:db8::6\n"
+    "foo AAAA 2001:db8::7\n";
+
+  static const struct {
+    const char *owner;
+    uint16_t type;
+    size_t count;
+    uint8_t rdata[3];
+  } rrsets[] = {
+    { "\3foo\7example", ZONE_TYPE_A, 3, { 1, 2, 3 } },
+    { "\3foo\7example", ZONE_TYPE_AAAA, 1, { 4 } },
+    { "\3bar\7example", ZONE_TYPE_AAAA, 2, { 5, 6 } },
+    { "\3foo\7example", ZONE_TYPE_AAAA, 1, { 7 } }
+  };
+
+  recording_t *recording;
+
+  (void)state;
+
+  recording = malloc(sizeof(*recording));
+  assert_non_null(recording);
+  assert_int_equal(parse(text, 4, recording), ZONE_SUCCESS);
+  assert_int_equal(recording->count, 4);
+  for (size_t i=0; i < 4; i++) {
+    assert_int_equal(recording->rrsets[i].length, 13);
+    assert_memory_equal(recording->rrsets[i].owner, rrsets[i].owner, 13);
+    assert_int_equal(recording->rrsets[i].type, rrsets[i].type);
+    assert_int_equal(recording->rrsets[i].count, rrsets[i].count);
+    assert_memory_equal(recording->rrsets[i].rdata, rrsets[i].rdata, rrsets[i].count);
+  }
+
+  assert_int_equal(recording->rrsets[0].ttls[0], 300);
+  assert_int_equal(recording->rrsets[0].ttls[1], 600);
+
+  free(recording);
+}
+
+/*!cmocka */
+void rrsets_split_by_buffers(void **state)
+{
+  static const char text[] =
+    "foo A 192.0.2.1\n"
+    "foo A 192.0.2.2\n"
+    "foo A 192.0.2.3\n"
+    "foo A 192.0.2.4\n"
+    "foo A 192.0.2.5\n"
+    "bar A 192.0.2.6\n";
+
+  recording_t *recording;
+
+  (void)state;
+
+  recording = malloc(sizeof(*recording));
+  assert_non_null(recording);
+  assert_int_equal(parse(text, 2, recording), ZONE_SUCCESS);
+  assert_int_equal(recording->count, 4);
+  assert_int_equal(recording->rrsets[0].count, 2);
+  assert_int_equal(recording->rrsets[1].count, 2);
+  assert_int_equal(recording->rrsets[2].count, 1);
+  assert_int_equal(recording->rrsets[3].count, 1);
+  for (size_t i=0, rr=1; i < 4; i++)
+    for (size_t j=0; j < recording->rrsets[i].count; j++, rr++)
+      assert_int_equal(recording->rrsets[i].rdata[j], rr);
+
+  free(recording);
+}
+
+/*!cmocka */
+void positive_rrset_continues(void **state)
+{
+  static const char text[] =
+    "foo A 192.0.2.1\n"
+    "foo A 192.0.2.2\n"
+    "foo A 192.0.2.3\n"
+    "bar A 192.0.2.4\n";
+
+  recording_t *recording;
+
+  (void)state;
+
+  recording = malloc(sizeof(*recording));
+  assert_non_null(recording);
+  // first RRset is delivered in two parts
+  assert_int_equal(parse_with_code(text, 2, 1, recording), 1);
+  assert_int_equal(recording->count, 3);
+  assert_int_equal(recording->rrsets[2].count, 1);
+  assert_int_equal(recording->rrsets[2].rdata[0], 4);
+
+  free(recording);
+}
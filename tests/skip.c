@@ -0,0 +1,122 @@
+/*
+ * skip.c -- test skipping owners and subtrees from the accept callback
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+typedef struct skip skip_t;
+struct skip {
+  int32_t code;
+  size_t count;
+  uint8_t addresses[8];
+};
+
+static int32_t skip_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  skip_t *skip = user_data;
+
+  (void)parser;
+  (void)owner;
+  (void)class;
+  (void)ttl;
+
+  if (type != ZONE_TYPE_A || rdlength != 4 || skip->count == 8)
+    return ZONE_SEMANTIC_ERROR;
+  skip->addresses[skip->count++] = rdata[3];
+  // skip everything that follows the first RR of a.example.
+  return rdata[3] == 1 ? skip->code : 0;
+}
+
+static int32_t parse_skipped(skip_t *skip, const char *text)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.accept.callback = &skip_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, skip);
+  free(input);
+  return code;
+}
+
+/*!cmocka */
+void skip_owner(void **state)
+{
+  skip_t skip = { ZONE_SKIP_OWNER, 0, { 0 } };
+  int32_t code;
+
+  (void)state;
+
+  // RDATA of skipped RRs is invalid on purpose, it must not be decoded. RRs
+  // below the skipped owner are not skipped
+  static const char text[] =
+    "a.example. A 192.0.2.1\n"
+    "           A 192.0.2.2\n"
+    "a.example. TXT \"not an address\"\n"
+    "A.EXAMPLE. A not-an-address\n"
+    "b.a.example. A 192.0.2.3\n"
+    "b.example. A 192.0.2.4\n"
+    "a.example. A 192.0.2.5\n";
+
+  code = parse_skipped(&skip, text);
+  assert_int_equal(code, ZONE_SUCCESS);
+  assert_int_equal(skip.count, 4);
+  assert_memory_equal(skip.addresses, "\1\3\4\5", 4);
+}
+
+/*!cmocka */
+void skip_subtree(void **state)
+{
+  static const char text[] =
+    "a.example. A 192.0.2.1\n"
+    "           A 192.0.2.2\n"
+    "A.EXAMPLE. A not-an-address\n"
+    "b.a.example. A not-an-address\n"
+    "             A not-an-address\n"
+    "b.example. A 192.0.2.4\n"
+    "a.example. A 192.0.2.5\n";
+
+  skip_t skip = { ZONE_SKIP_SUBTREE, 0, { 0 } };
+  int32_t code;
+
+  (void)state;
+
+  code = parse_skipped(&skip, text);
+  assert_int_equal(code, ZONE_SUCCESS);
+  assert_int_equal(skip.count, 3);
+  assert_memory_equal(skip.addresses, "\1\4\5", 3);
+}
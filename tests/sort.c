@@ -0,0 +1,260 @@
+/*
+ * sort.c -- test canonical ordering of RRs
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+static int32_t add_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  (void)parser;
+  return zone_sorter_add(user_data, owner, type, class, ttl, rdlength, rdata);
+}
+
+static int32_t parse_sorted(zone_sorter_t *sorter, const char *text)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.accept.callback = &add_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, sorter);
+  free(input);
+  return code;
+}
+
+/*!cmocka */
+void canonical_name_order(void **state)
+{
+  // example from RFC 4034 section 6.1, in reverse
+  static const char text[] =
+    "\\200.z.example. A 192.0.2.1\n"
+    "*.z.example. A 192.0.2.1\n"
+    "\\001.z.example. A 192.0.2.1\n"
+    "z.example. A 192.0.2.1\n"
+    "zABC.a.EXAMPLE. A 192.0.2.1\n"
+    "Z.a.example. A 192.0.2.1\n"
+    "yljkjljk.a.example. A 192.0.2.1\n"
+    "a.example. A 192.0.2.1\n"
+    "example. A 192.0.2.1\n";
+
+  static const char *owners[] = {
+    "\7example\0",
+    "\1a\7example\0",
+    "\10yljkjljk\1a\7example\0",
+    "\1Z\1a\7example\0",
+    "\4zABC\1a\7EXAMPLE\0",
+    "\1z\7example\0",
+    "\1\1\1z\7example\0",
+    "\1*\1z\7example\0",
+    "\1\310\1z\7example\0"
+  };
+
+  zone_sorter_t sorter;
+  zone_rr_t rr;
+  int32_t code;
+
+  (void)state;
+
+  zone_sorter_init(&sorter);
+  code = parse_sorted(&sorter, text);
+  assert_int_equal(code, ZONE_SUCCESS);
+  zone_sorter_sort(&sorter);
+
+  assert_int_equal(zone_sorter_size(&sorter), 9);
+  for (size_t i=0; i < 9; i++) {
+    size_t length = 0;
+    while (owners[i][length])
+      length += (size_t)(uint8_t)owners[i][length] + 1;
+    length++;
+    zone_sorter_get(&sorter, i, &rr);
+    assert_int_equal(rr.owner.length, length);
+    assert_memory_equal(rr.owner.octets, owners[i], length);
+  }
+
+  zone_sorter_destroy(&sorter);
+}
+
+/*!cmocka */
+void canonical_rr_order(void **state)
+{
+  static const char text[] =
+    "foo. TXT \"b\"\n"
+    "foo. TXT \"a\"\n"
+    "foo. A 192.0.2.2\n"
+    "foo. A 192.0.2.1\n"
+    "foo. TXT \"a\" \"b\"\n"
+    "foo. CH TXT \"a\"\n";
+
+  static const struct {
+    uint16_t type, class, rdlength;
+    const char *rdata;
+  } rrs[] = {
+    { ZONE_TYPE_A, ZONE_CLASS_IN, 4, "\xc0\x00\x02\x01" },
+    { ZONE_TYPE_A, ZONE_CLASS_IN, 4, "\xc0\x00\x02\x02" },
+    { ZONE_TYPE_TXT, ZONE_CLASS_IN, 2, "\1a" },
+    { ZONE_TYPE_TXT, ZONE_CLASS_IN, 4, "\1a\1b" },
+    { ZONE_TYPE_TXT, ZONE_CLASS_IN, 2, "\1b" },
+    { ZONE_TYPE_TXT, ZONE_CLASS_CH, 2, "\1a" }
+  };
+
+  zone_sorter_t sorter;
+  zone_rr_t rr;
+  int32_t code;
+
+  (void)state;
+
+  zone_sorter_init(&sorter);
+  code = parse_sorted(&sorter, text);
+  assert_int_equal(code, ZONE_SUCCESS);
+  zone_sorter_sort(&sorter);
+
+  assert_int_equal(zone_sorter_size(&sorter), 6);
+  for (size_t i=0; i < 6; i++) {
+    zone_sorter_get(&sorter, i, &rr);
+    assert_int_equal(rr.type, rrs[i].type);
+    assert_int_equal(rr.class, rrs[i].class);
+    assert_int_equal(rr.rdlength, rrs[i].rdlength);
+    assert_memory_equal(rr.rdata, rrs[i].rdata, rrs[i].rdlength);
+  }
+
+  zone_sorter_destroy(&sorter);
+}
+
+/*!cmocka */
+void sort_slices(void **state)
+{
+  zone_sorter_t sorter, reference;
+  zone_rr_t rr1, rr2;
+  char *text;
+  size_t length = 0, size = 1000 * 64;
+
+  (void)state;
+
+  text = malloc(size);
+  assert_non_null(text);
+  for (int i=0; i < 1000; i++)
+    length += (size_t)snprintf(
+      text + length, size - length, "h%d.d%d A 192.0.2.%d\n",
+      (i * 7919) % 1000, (i * 31) % 17, i % 256);
+
+  zone_sorter_init(&reference);
+  assert_int_equal(parse_sorted(&reference, text), ZONE_SUCCESS);
+  zone_sorter_sort(&reference);
+
+  for (size_t slices=1; slices <= 9; slices++) {
+    zone_sorter_init(&sorter);
+    assert_int_equal(parse_sorted(&sorter, text), ZONE_SUCCESS);
+    for (size_t slice=0; slice < slices; slice++)
+      zone_sorter_sort_slice(&sorter, slice, slices);
+    zone_sorter_merge(&sorter, slices);
+
+    assert_int_equal(zone_sorter_size(&sorter), 1000);
+    for (size_t i=0; i < 1000; i++) {
+      zone_sorter_get(&sorter, i, &rr1);
+      zone_sorter_get(&reference, i, &rr2);
+      assert_int_equal(rr1.owner.length, rr2.owner.length);
+      assert_memory_equal(rr1.owner.octets, rr2.owner.octets, rr1.owner.length);
+      assert_int_equal(rr1.rdlength, rr2.rdlength);
+      assert_memory_equal(rr1.rdata, rr2.rdata, rr1.rdlength);
+    }
+
+    zone_sorter_destroy(&sorter);
+  }
+
+  zone_sorter_destroy(&reference);
+  free(text);
+}
+
+typedef struct drained drained_t;
+struct drained {
+  size_t count;
+  uint64_t *records;
+};
+
+static int32_t drain_rr(const zone_rr_t *rr, void *user_data)
+{
+  drained_t *drained = user_data;
+
+  drained->records[drained->count++] = fingerprint(
+    &rr->owner, rr->type, rr->class, rr->ttl, rr->rdlength, rr->rdata);
+  return 0;
+}
+
+/*!cmocka */
+void external_sort(void **state)
+{
+  zone_sorter_t sorter;
+  drained_t drained[2];
+  char *text;
+  size_t length = 0, size = 20000 * 64;
+
+  (void)state;
+
+  // every RR appears four times
+  text = malloc(size);
+  assert_non_null(text);
+  for (int i=0; i < 20000; i++) {
+    const int j = (i * 7919) % 5000;
+    length += (size_t)snprintf(
+      text + length, size - length, "host%d.d%d A 192.0.2.%d\n", j, j % 17, j % 256);
+  }
+
+  for (size_t i=0; i < 2; i++) {
+    drained[i].count = 0;
+    drained[i].records = calloc(20000, sizeof(uint64_t));
+    assert_non_null(drained[i].records);
+    zone_sorter_init(&sorter);
+    if (i == 1) {
+      assert_int_equal(zone_sorter_limit(&sorter, 1024), ZONE_BAD_PARAMETER);
+      assert_int_equal(zone_sorter_limit(&sorter, 256 * 1024), ZONE_SUCCESS);
+    }
+    assert_int_equal(parse_sorted(&sorter, text), ZONE_SUCCESS);
+    if (i == 1)
+      assert_true(sorter.runs.count > 1);
+    assert_int_equal(zone_sorter_drain(&sorter, &drain_rr, &drained[i]), ZONE_SUCCESS);
+    zone_sorter_destroy(&sorter);
+  }
+
+  assert_int_equal(drained[0].count, 5000);
+  assert_int_equal(drained[1].count, 5000);
+  assert_memory_equal(drained[0].records, drained[1].records, 5000 * sizeof(uint64_t));
+
+  free(drained[0].records);
+  free(drained[1].records);
+  free(text);
+}
@@ -0,0 +1,187 @@
+/*
+ * step.c -- test parsing in steps
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+#define RECORDS (1000)
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  uint64_t records[RECORDS];
+};
+
+static int32_t record_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  assert_true(recording->count < RECORDS);
+  recording->records[recording->count++] =
+    fingerprint(owner, type, class, ttl, rdlength, rdata);
+  return 0;
+}
+
+static int32_t record_batch(
+  zone_parser_t *parser, const zone_batch_t *batch, void *user_data)
+{
+  for (size_t i=0; i < batch->count; i++)
+    (void)record_rr(
+      parser, &batch->owners[i], batch->types[i], batch->classes[i],
+      batch->ttls[i], batch->rdlengths[i], batch->rdata[i], user_data);
+  return 0;
+}
+
+static void initialize_options(zone_options_t *options)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+
+  memset(options, 0, sizeof(*options));
+  options->accept.callback = &record_rr;
+  options->origin.octets = origin;
+  options->origin.length = sizeof(origin);
+  options->default_ttl = 3600;
+  options->default_class = ZONE_CLASS_IN;
+}
+
+/*!cmocka */
+void parse_in_steps(void **state)
+{
+  static char text[RECORDS * 64];
+  int length = 0;
+  char *path;
+
+  (void)state;
+
+  for (int i=0; i < RECORDS / 2; i++)
+    length += snprintf(text + length, sizeof(text) - (size_t)length,
+      "host%d A 192.0.2.%d\n  TXT \"%d\"\n", i, i % 256, i);
+  path = write_file(text);
+  assert_non_null(path);
+
+  zone_parser_t parser;
+  zone_buffers_t buffers;
+  zone_options_t options;
+  recording_t *reference, *stepped;
+  int32_t code;
+
+  reference = calloc(1, sizeof(*reference));
+  stepped = calloc(1, sizeof(*stepped));
+  assert_non_null(reference);
+  assert_non_null(stepped);
+  buffers.owner = calloc(ZONE_BATCH_SIZE, sizeof(*buffers.owner));
+  buffers.rdata = calloc(ZONE_BATCH_SIZE, sizeof(*buffers.rdata));
+  assert_non_null(buffers.owner);
+  assert_non_null(buffers.rdata);
+
+  initialize_options(&options);
+  buffers.size = 1;
+  code = zone_parse(&parser, &options, &buffers, path, reference);
+  assert_int_equal(code, ZONE_SUCCESS);
+  assert_int_equal(reference->count, RECORDS);
+
+  static const size_t budgets[] = { 1, 7, 100, RECORDS, RECORDS + 1 };
+  for (size_t batched=0; batched < 2; batched++) {
+    for (size_t i=0; i < sizeof(budgets)/sizeof(budgets[0]); i++) {
+      size_t steps = 0;
+
+      initialize_options(&options);
+      buffers.size = 1;
+      if (batched) {
+        options.batch.callback = &record_batch;
+        buffers.size = ZONE_BATCH_SIZE;
+      }
+
+      memset(stepped, 0, sizeof(*stepped));
+      code = zone_open(&parser, &options, &buffers, path, stepped);
+      assert_int_equal(code, ZONE_SUCCESS);
+      assert_int_equal(zone_parse_step(&parser, 0), ZONE_BAD_PARAMETER);
+      while ((code = zone_parse_step(&parser, budgets[i])) == ZONE_AGAIN) {
+        steps++;
+        // budget is exhausted exactly, unless RRs are batched
+        if (!batched)
+          assert_int_equal(stepped->count, steps * budgets[i]);
+      }
+      assert_int_equal(code, ZONE_SUCCESS);
+      assert_int_equal(steps, RECORDS / budgets[i]);
+      zone_close(&parser);
+
+      assert_int_equal(stepped->count, RECORDS);
+      assert_memory_equal(
+        stepped->records, reference->records, RECORDS * sizeof(uint64_t));
+    }
+  }
+
+  free(buffers.owner);
+  free(buffers.rdata);
+  free(reference);
+  free(stepped);
+  remove(path);
+  free(path);
+}
+
+/*!cmocka */
+void skipped_rrs_spend_budget(void **state)
+{
+  static const uint16_t types[] = { ZONE_TYPE_MX };
+  static char text[RECORDS * 64];
+  int length = 0;
+  char *path;
+
+  (void)state;
+
+  for (int i=0; i < RECORDS; i++)
+    length += snprintf(text + length, sizeof(text) - (size_t)length,
+      "host%d A 192.0.2.%d\n", i, i % 256);
+  path = write_file(text);
+  assert_non_null(path);
+
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  recording_t *stepped;
+  size_t steps = 0;
+  int32_t code;
+
+  stepped = calloc(1, sizeof(*stepped));
+  assert_non_null(stepped);
+
+  // filter matches none of the RRs, steps must remain bounded regardless
+  initialize_options(&options);
+  options.filter.types = types;
+  options.filter.count = 1;
+  code = zone_open(&parser, &options, &buffers, path, stepped);
+  assert_int_equal(code, ZONE_SUCCESS);
+  while ((code = zone_parse_step(&parser, 10)) == ZONE_AGAIN)
+    steps++;
+  assert_int_equal(code, ZONE_SUCCESS);
+  assert_int_equal(steps, RECORDS / 10);
+  assert_int_equal(stepped->count, 0);
+  zone_close(&parser);
+
+  free(stepped);
+  remove(path);
+  free(path);
+}
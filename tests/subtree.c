@@ -0,0 +1,119 @@
+/*
+ * subtree.c -- test filtering RRs by subtree
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+
+typedef struct recording recording_t;
+struct recording {
+  size_t count;
+  uint8_t addresses[16];
+  uint32_t ttls[16];
+};
+
+static int32_t accept_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  recording_t *recording = user_data;
+  (void)parser;
+  (void)owner;
+  (void)class;
+  if (type != ZONE_TYPE_A || rdlength != 4 || recording->count == 16)
+    return ZONE_SEMANTIC_ERROR;
+  recording->ttls[recording->count] = ttl;
+  recording->addresses[recording->count++] = rdata[3];
+  return 0;
+}
+
+static int32_t parse(
+  const char *text, const zone_name_t *roots, size_t count, recording_t *recording)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.accept.callback = &accept_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+  options.subtree.roots = roots;
+  options.subtree.count = count;
+
+  memset(recording, 0, sizeof(*recording));
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, recording);
+  free(input);
+  return code;
+}
+
+/*!cmocka */
+void subtree_roots(void **state)
+{
+  // RDATA of out of scope records is not decoded and need not be valid
+  static const char text[] =
+    "example. 100 A 192.0.2.1\n"
+    "foo A 192.0.2.2\n"
+    "    A 192.0.2.3\n"
+    "bar.FOO 200 A 192.0.2.4\n"
+    "    A 192.0.2.5\n"
+    "xfoo A 192.0.2.6\n"
+    "     TXT not decoded\n"
+    "foo.xbar A 192.0.2.7\n"
+    "baz A 192.0.2.8\n"
+    "a.b.qux 300 TXT ( not\n"
+    "   decoded )\n"
+    "bar.foo A 192.0.2.9\n";
+
+  static const zone_name_t roots[] = {
+    { 13, (const uint8_t *)"\3foo\7example" },
+    { 13, (const uint8_t *)"\3BAZ\7example" }
+  };
+
+  static const uint8_t addresses[] = { 2, 3, 4, 5, 8, 9 };
+  // TTL of out of scope records is inherited
+  static const uint32_t ttls[] = { 100, 100, 200, 200, 200, 300 };
+  recording_t recording;
+
+  (void)state;
+
+  assert_int_equal(parse(text, roots, 2, &recording), ZONE_SUCCESS);
+  assert_int_equal(recording.count, 6);
+  assert_memory_equal(recording.addresses, addresses, sizeof(addresses));
+  assert_memory_equal(recording.ttls, ttls, sizeof(ttls));
+
+  // root is a subtree of every name
+  static const zone_name_t root = { 1, (const uint8_t *)"" };
+  assert_int_equal(parse(text, &root, 1, &recording), ZONE_SEMANTIC_ERROR);
+
+  static const zone_name_t bad = { 0, (const uint8_t *)"" };
+  assert_int_equal(parse(text, &bad, 1, &recording), ZONE_BAD_PARAMETER);
+}
@@ -1223,3 +1223,83 @@ void contiguous_escaped_reset(void** state)
     NULL);
   assert_int_equal(result, ZONE_SUCCESS);
 }
+
+typedef struct tape_boundary tape_boundary_t;
+struct tape_boundary {
+  size_t count;
+  size_t mismatches;
+};
+
+static int32_t tape_boundary_callback(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  tape_boundary_t *boundary = (tape_boundary_t *)user_data;
+  char label[8];
+
+  (void)parser;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+
+  (void)snprintf(label, sizeof(label), "%05u", (unsigned)boundary->count);
+  if (owner->length != 7 || owner->octets[0] != 5 ||
+      memcmp(owner->octets + 1, label, 5) != 0)
+    boundary->mismatches++;
+  boundary->count++;
+  return 0;
+}
+
+/*!cmocka */
+void tape_boundaries(void **state)
+{
+  /* Lines of exactly 32 bytes with many short fields fill the tape in
+   * fewer blocks than there are entries and make every tape start at the
+   * start of a line. Strings are never moved on refill, check owners
+   * are not taken as blank after a tape boundary. */
+#define LINES (4096)
+#define LINE_LENGTH (32)
+  static uint8_t origin[] = { 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  tape_boundary_t boundary = { 0, 0 };
+  int32_t result;
+  (void) state;
+
+  const size_t length = LINES * LINE_LENGTH;
+  char *zone = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(zone);
+  for (size_t i=0; i < LINES; i++) {
+    int count = snprintf(zone + (i * LINE_LENGTH), LINE_LENGTH + 1,
+      "%05u TXT a b c d e f g h i j k\n", (unsigned)i);
+    assert_int_equal(count, LINE_LENGTH);
+  }
+  memset(zone + length, 0, 1 + ZONE_BLOCK_SIZE);
+
+  memset(&options, 0, sizeof(options));
+  options.accept.callback = tape_boundary_callback;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  result = zone_parse_string(&parser, &options, &buffers, zone, length,
+    &boundary);
+  free(zone);
+  assert_int_equal(result, ZONE_SUCCESS);
+  assert_int_equal(boundary.count, LINES);
+  assert_int_equal(boundary.mismatches, 0);
+#undef LINES
+#undef LINE_LENGTH
+}
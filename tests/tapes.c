@@ -0,0 +1,152 @@
+/*
+ * tapes.c -- test tapes shared between include levels
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "tools.h"
+
+#define RECORDS (1000)
+
+typedef struct sequence sequence_t;
+struct sequence {
+  size_t count;
+  char owners[5 * RECORDS][16];
+};
+
+static int32_t add_rr(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  sequence_t *sequence = user_data;
+  (void)parser;
+  (void)type;
+  (void)class;
+  (void)ttl;
+  (void)rdlength;
+  (void)rdata;
+  if (sequence->count == 5 * RECORDS || owner->octets[0] >= 16)
+    return ZONE_SEMANTIC_ERROR;
+  memcpy(sequence->owners[sequence->count], owner->octets + 1, owner->octets[0]);
+  sequence->owners[sequence->count][owner->octets[0]] = '\0';
+  sequence->count++;
+  return 0;
+}
+
+static int print_records(
+  char *text, size_t size, const char *prefix, int first, int last)
+{
+  int length = 0;
+  for (int i=first; i < last; i++)
+    length += snprintf(text + length, size - (size_t)length,
+      "%s%d A 192.0.2.%d\n", prefix, i, i % 256);
+  return length;
+}
+
+static void assert_sequence(const sequence_t *sequence, const char *prefixes)
+{
+  size_t count = 0;
+  for (const char *prefix = prefixes; *prefix; prefix++) {
+    for (int i=0; i < RECORDS; i++, count++) {
+      char owner[16];
+      (void)snprintf(owner, sizeof(owner), "%c%d", *prefix, i);
+      assert_true(count < sequence->count);
+      assert_string_equal(sequence->owners[count], owner);
+    }
+  }
+  assert_int_equal(sequence->count, count);
+}
+
+/*!cmocka */
+void parser_footprint(void **state)
+{
+  (void)state;
+  // tapes are allocated on demand, idle parsers require only a few KB
+  assert_true(sizeof(zone_parser_t) < 4096);
+  assert_true(sizeof(zone_file_t) < 2048);
+}
+
+/*!cmocka */
+void share_tapes_between_includes(void **state)
+{
+  static char text[4 * 32 * RECORDS];
+  char *inner_path, *outer_path, *zone_path;
+  int length;
+
+  (void)state;
+
+  // every file spans multiple windows and tapes
+  length = print_records(text, sizeof(text), "c", 0, RECORDS);
+  inner_path = write_file(text);
+  assert_non_null(inner_path);
+
+  length = print_records(text, sizeof(text), "b", 0, RECORDS);
+  length += snprintf(text + length, sizeof(text) - (size_t)length,
+    "$INCLUDE %s\n", inner_path);
+  length += print_records(text + length, sizeof(text) - (size_t)length, "d", 0, RECORDS);
+  outer_path = write_file(text);
+  assert_non_null(outer_path);
+
+  length = print_records(text, sizeof(text), "a", 0, RECORDS);
+  length += snprintf(text + length, sizeof(text) - (size_t)length,
+    "$INCLUDE \"%s\" ; comment\n", outer_path);
+  length += print_records(text + length, sizeof(text) - (size_t)length, "e", 0, RECORDS);
+  zone_path = write_file(text);
+  assert_non_null(zone_path);
+
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  sequence_t *sequence;
+
+  memset(&options, 0, sizeof(options));
+  options.accept.callback = &add_rr;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  sequence = calloc(1, sizeof(*sequence));
+  assert_non_null(sequence);
+  assert_int_equal(
+    zone_parse(&parser, &options, &buffers, zone_path, sequence), ZONE_SUCCESS);
+  assert_sequence(sequence, "abcde");
+
+  // tapes of string input are sized for the string
+  char *string = calloc(length + 1 + ZONE_BLOCK_SIZE, 1);
+  assert_non_null(string);
+  length = snprintf(string, (size_t)length + 1, "$INCLUDE %s\n", outer_path);
+  memset(sequence, 0, sizeof(*sequence));
+  assert_int_equal(
+    zone_parse_string(&parser, &options, &buffers, string, (size_t)length, sequence),
+    ZONE_SUCCESS);
+  assert_sequence(sequence, "bcd");
+
+  free(string);
+  free(sequence);
+  remove(zone_path);
+  remove(outer_path);
+  remove(inner_path);
+  free(zone_path);
+  free(outer_path);
+  free(inner_path);
+}
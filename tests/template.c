@@ -0,0 +1,105 @@
+/*
+ * template.c -- test kernel compiled in template mode
+ *
+ * Copyright (c) 2025, NLnet Labs. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include <stdarg.h>
+#include <setjmp.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include "zone.h"
+#include "attributes.h"
+
+typedef struct inlined inlined_t;
+struct inlined {
+  size_t records;
+  uint32_t ttls;
+};
+
+static really_inline int32_t inline_accept(
+  zone_parser_t *parser,
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata,
+  void *user_data)
+{
+  inlined_t *inlined = user_data;
+
+  (void)parser;
+  (void)class;
+  (void)rdlength;
+  (void)rdata;
+  inlined->records++;
+  inlined->ttls += ttl;
+  // skip codes are honored in template mode too
+  if (type == ZONE_TYPE_NS && owner->octets[0] == 3)
+    return ZONE_SKIP_OWNER;
+  return ZONE_SUCCESS;
+}
+
+#define ZONE_ACCEPT inline_accept
+#define ZONE_PARSE template_parse
+#include "fallback/parser.c"
+
+static int32_t parse_template(
+  const char *text, zone_kernel_t kernel, inlined_t *inlined)
+{
+  static const uint8_t origin[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0 };
+  zone_parser_t parser;
+  zone_name_buffer_t name;
+  zone_rdata_buffer_t rdata;
+  zone_buffers_t buffers = { 1, &name, &rdata };
+  zone_options_t options;
+  int32_t code;
+
+  memset(&options, 0, sizeof(options));
+  options.kernel = kernel;
+  options.origin.octets = origin;
+  options.origin.length = sizeof(origin);
+  options.default_ttl = 3600;
+  options.default_class = ZONE_CLASS_IN;
+
+  size_t length = strlen(text);
+  char *input = malloc(length + 1 + ZONE_BLOCK_SIZE);
+  assert_non_null(input);
+  memcpy(input, text, length);
+  memset(input + length, 0, 1 + ZONE_BLOCK_SIZE);
+  code = zone_parse_string(&parser, &options, &buffers, input, length, inlined);
+  free(input);
+  return code;
+}
+
+/*!cmocka */
+void template_kernel(void **state)
+{
+  static const char text[] =
+    "foo. 1 A 192.0.2.1\n"
+    "foo. 2 NS ns.foo.\n"
+    "foo. 4 A 192.0.2.2\n"
+    "bar. 8 A 192.0.2.3\n";
+
+  inlined_t inlined;
+  int32_t code;
+
+  (void)state;
+
+  // accept callback is required without a kernel generated in template mode
+  memset(&inlined, 0, sizeof(inlined));
+  code = parse_template(text, NULL, &inlined);
+  assert_int_equal(code, ZONE_BAD_PARAMETER);
+
+  memset(&inlined, 0, sizeof(inlined));
+  code = parse_template(text, &template_parse, &inlined);
+  assert_int_equal(code, ZONE_SUCCESS);
+  assert_int_equal(inlined.records, 3);
+  assert_int_equal(inlined.ttls, 1 + 2 + 8);
+}
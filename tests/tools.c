@@ -24,6 +24,7 @@
 #endif
 
 #include "diagnostic.h"
+#include "tools.h"
 
 static bool is_dir(const char *dir)
 {
@@ -92,3 +93,50 @@ diagnostic_pop()
 
   return NULL;
 }
+
+char *write_file(const char *content)
+{
+  char *path = NULL;
+  FILE *handle = NULL;
+
+  for (int i=0; i < 100 && !handle; i++) {
+    if (path)
+      free(path);
+    if (!(path = get_tempnam(NULL, "zone")))
+      return NULL;
+diagnostic_push()
+msvc_diagnostic_ignored(4996)
+    handle = fopen(path, "wbx");
+diagnostic_pop()
+  }
+
+  if (!handle) {
+    free(path);
+    return NULL;
+  }
+
+  (void)fputs(content, handle);
+  (void)fclose(handle);
+  return path;
+}
+
+uint64_t fingerprint(
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata)
+{
+  uint64_t hash = 14695981039346656037ull;
+#define MIX(octet) hash = (hash ^ (uint8_t)(octet)) * 1099511628211ull
+  for (size_t i=0; i < owner->length; i++)
+    MIX(owner->octets[i]);
+  MIX(type); MIX(type >> 8);
+  MIX(class); MIX(class >> 8);
+  MIX(ttl); MIX(ttl >> 8); MIX(ttl >> 16); MIX(ttl >> 24);
+  for (size_t i=0; i < rdlength; i++)
+    MIX(rdata[i]);
+#undef MIX
+  return hash;
+}
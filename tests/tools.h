@@ -9,8 +9,24 @@
 #ifndef TOOLS_H
 #define TOOLS_H
 
+#include <stdint.h>
+
+#include "zone.h"
+
 // this is not safe to use in a production environment, but it's good enough
 // for tests
 char *get_tempnam(const char *dir, const char *prefix);
 
+// write content to a temporary file, returns the path, which must be freed
+char *write_file(const char *content);
+
+// FNV-1a hash of an RR to compare RRs delivered by different means
+uint64_t fingerprint(
+  const zone_name_t *owner,
+  uint16_t type,
+  uint16_t class,
+  uint32_t ttl,
+  uint16_t rdlength,
+  const uint8_t *rdata);
+
 #endif // TOOLS_H